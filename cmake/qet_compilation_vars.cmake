@@ -167,6 +167,10 @@ set(QET_SRC_FILES
   ${QET_DIR}/sources/main.cpp
   ${QET_DIR}/sources/newelementwizard.cpp
   ${QET_DIR}/sources/newelementwizard.h
+  ${QET_DIR}/sources/potentialindex.cpp
+  ${QET_DIR}/sources/potentialindex.h
+  ${QET_DIR}/sources/projectbatchexporter.cpp
+  ${QET_DIR}/sources/projectbatchexporter.h
   ${QET_DIR}/sources/projectview.cpp
   ${QET_DIR}/sources/projectview.h
   ${QET_DIR}/sources/qetapp.cpp
@@ -370,6 +374,8 @@ set(QET_SRC_FILES
 
   ${QET_DIR}/sources/factory/elementfactory.cpp
   ${QET_DIR}/sources/factory/elementfactory.h
+  ${QET_DIR}/sources/factory/elementdefinitioncache.cpp
+  ${QET_DIR}/sources/factory/elementdefinitioncache.h
   ${QET_DIR}/sources/factory/elementpicturefactory.cpp
   ${QET_DIR}/sources/factory/elementpicturefactory.h
   ${QET_DIR}/sources/factory/propertieseditorfactory.cpp
@@ -684,6 +690,8 @@ set(QET_SRC_FILES
   ${QET_DIR}/sources/undocommand/changetitleblockcommand.h
   ${QET_DIR}/sources/undocommand/deleteqgraphicsitemcommand.cpp
   ${QET_DIR}/sources/undocommand/deleteqgraphicsitemcommand.h
+  ${QET_DIR}/sources/undocommand/diagramsundocommand.cpp
+  ${QET_DIR}/sources/undocommand/diagramsundocommand.h
   ${QET_DIR}/sources/undocommand/itemmodelcommand.cpp
   ${QET_DIR}/sources/undocommand/itemmodelcommand.h
   ${QET_DIR}/sources/undocommand/linkelementcommand.cpp
@@ -697,12 +705,17 @@ set(QET_SRC_FILES
 
   ${QET_DIR}/sources/utils/conductorcreator.cpp
   ${QET_DIR}/sources/utils/conductorcreator.h
+  ${QET_DIR}/sources/utils/formulatemplate.cpp
+  ${QET_DIR}/sources/utils/formulatemplate.h
   ${QET_DIR}/sources/utils/macosxopenevent.cpp
   ${QET_DIR}/sources/utils/macosxopenevent.h
+  ${QET_DIR}/sources/utils/potentialpartition.h
   ${QET_DIR}/sources/utils/qetsettings.cpp
   ${QET_DIR}/sources/utils/qetsettings.h
   ${QET_DIR}/sources/utils/qetutils.cpp
   ${QET_DIR}/sources/utils/qetutils.h
+  ${QET_DIR}/sources/utils/searchindex.cpp
+  ${QET_DIR}/sources/utils/searchindex.h
 
   ${QET_DIR}/sources/xml/terminalstripitemxml.cpp
   ${QET_DIR}/sources/xml/terminalstripitemxml.h
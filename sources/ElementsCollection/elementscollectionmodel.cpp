@@ -36,6 +36,43 @@
 ElementsCollectionModel::ElementsCollectionModel(QObject *parent) :
 	QStandardItemModel(parent)
 {
+		//Keep the search index up to date once it is built.
+		//The data of the items is set in the thread pool while loading,
+		//these signals are then queued to the thread of the model.
+	connect(this, &QStandardItemModel::rowsInserted,
+		this, [this](const QModelIndex &parent, int first, int last) {
+		if (m_search_index_built) {
+			indexRows(parent, first, last);
+		}
+	});
+	connect(this, &QStandardItemModel::rowsAboutToBeRemoved,
+		this, [this](const QModelIndex &parent, int first, int last) {
+		if (m_search_index_built) {
+			unindexRows(parent, first, last);
+		}
+	});
+	connect(this, &QStandardItemModel::dataChanged,
+		this, [this](const QModelIndex &top_left,
+			     const QModelIndex &bottom_right,
+			     const QVector<int> &roles)
+	{
+		if (!m_search_index_built
+				|| !top_left.isValid()
+				|| (!roles.isEmpty() && !roles.contains(Qt::UserRole+1))) {
+			return;
+		}
+		for (int row = top_left.row() ; row <= bottom_right.row() ; ++row)
+		{
+			QStandardItem *qsi = itemFromIndex(top_left.sibling(row, 0));
+			if (qsi) {
+				m_search_index.insert(qsi, {qsi->data(Qt::UserRole+1).toString()});
+			}
+		}
+	});
+	connect(this, &QStandardItemModel::modelReset, this, [this]() {
+		m_search_index.clear();
+		m_search_index_built = false;
+	});
 }
 
 /**
@@ -304,6 +341,49 @@ void ElementsCollectionModel::loadCollections(bool common_collection,
 	watcher->setFuture(m_future);
 }
 
+/**
+	@brief ElementsCollectionModel::search
+	Search the items which contain text
+	in their search data (role Qt::UserRole+1), case insensitively.
+	The search index is built at the first search.
+	@param text
+	@param parent : if valid, search only in the children of parent
+	@return the index of the matching items
+*/
+QModelIndexList ElementsCollectionModel::search(const QString &text,
+						const QModelIndex &parent)
+{
+	if (!m_search_index_built)
+	{
+		m_search_index.clear();
+		m_search_index_built = true;
+		indexRows(QModelIndex(), 0, rowCount() - 1);
+	}
+
+	QStandardItem *parent_item = parent.isValid() ? itemFromIndex(parent)
+						      : nullptr;
+	QModelIndexList match_index;
+	for (QStandardItem *qsi : m_search_index.candidates(text))
+	{
+		if (!qsi->data(Qt::UserRole+1).toString().contains(text, Qt::CaseInsensitive)) {
+			continue;
+		}
+
+		if (parent_item)
+		{
+			QStandardItem *ancestor = qsi->parent();
+			while (ancestor && ancestor != parent_item) {
+				ancestor = ancestor->parent();
+			}
+			if (!ancestor) {
+				continue;
+			}
+		}
+		match_index << qsi->index();
+	}
+	return match_index;
+}
+
 /**
 	@brief ElementsCollectionModel::addCommonCollection
 	Add the common elements collection to this model
@@ -705,3 +785,55 @@ void ElementsCollectionModel::updateItem(const QString& path)
 		eci->setUpData();
 	}
 }
+
+/**
+	@brief ElementsCollectionModel::indexRows
+	Add the items of the rows first to last of parent
+	and all their children to the search index
+	@param parent
+	@param first
+	@param last
+*/
+void ElementsCollectionModel::indexRows(const QModelIndex &parent,
+					int first,
+					int last)
+{
+	for (int row = first ; row <= last ; ++row)
+	{
+		const QModelIndex row_index = index(row, 0, parent);
+		QStandardItem *qsi = itemFromIndex(row_index);
+		if (!qsi) {
+			continue;
+		}
+		m_search_index.insert(qsi, {qsi->data(Qt::UserRole+1).toString()});
+		if (qsi->rowCount()) {
+			indexRows(row_index, 0, qsi->rowCount() - 1);
+		}
+	}
+}
+
+/**
+	@brief ElementsCollectionModel::unindexRows
+	Remove the items of the rows first to last of parent
+	and all their children from the search index
+	@param parent
+	@param first
+	@param last
+*/
+void ElementsCollectionModel::unindexRows(const QModelIndex &parent,
+					  int first,
+					  int last)
+{
+	for (int row = first ; row <= last ; ++row)
+	{
+		const QModelIndex row_index = index(row, 0, parent);
+		QStandardItem *qsi = itemFromIndex(row_index);
+		if (!qsi) {
+			continue;
+		}
+		if (qsi->rowCount()) {
+			unindexRows(row_index, 0, qsi->rowCount() - 1);
+		}
+		m_search_index.remove(qsi);
+	}
+}
@@ -20,6 +20,7 @@
 
 #include <QStandardItemModel>
 #include <QHash>
+#include "../utils/searchindex.h"
 #include "elementslocation.h"
 
 class XmlProjectElementCollectionItem;
@@ -60,6 +61,8 @@ class ElementsCollectionModel : public QStandardItemModel
 		void hideElement();
 		bool isHideElement() {return m_hide_element;}
 		QModelIndex indexFromLocation(const ElementsLocation &location);
+		QModelIndexList search(const QString &text,
+				       const QModelIndex &parent = QModelIndex());
 
 	signals:
 		void loadingProgressValueChanged(int);
@@ -70,6 +73,8 @@ class ElementsCollectionModel : public QStandardItemModel
 		void elementIntegratedToCollection (const QString& path);
 		void itemRemovedFromCollection (const QString& path);
 		void updateItem (const QString& path);
+		void indexRows(const QModelIndex &parent, int first, int last);
+		void unindexRows(const QModelIndex &parent, int first, int last);
 
 	private:
 		QList <QETProject *> m_project_list;
@@ -77,6 +82,8 @@ class ElementsCollectionModel : public QStandardItemModel
 		bool m_hide_element = false;
 		QFuture<void> m_future;
 		QList <ElementCollectionItem *> m_items_list_to_setUp;
+		SearchIndex<QStandardItem *> m_search_index;
+		bool m_search_index_built = false;
 };
 
 #endif // ELEMENTSCOLLECTIONMODEL2_H
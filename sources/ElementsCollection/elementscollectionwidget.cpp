@@ -19,6 +19,7 @@
 
 #include "../editor/ui/qetelementeditor.h"
 #include "../elementscategoryeditor.h"
+#include "../elementscollectioncache.h"
 #include "../newelementwizard.h"
 #include "../qetapp.h"
 #include "../qetdiagrameditor.h"
@@ -675,6 +676,7 @@ void ElementsCollectionWidget::reload()
 */
 void ElementsCollectionWidget::loadingFinished()
 {
+	const bool collections_walked = m_new_model != nullptr;
 	if (m_new_model)
 	{
 		m_new_model->highlightUnusedElement();
@@ -693,6 +695,18 @@ void ElementsCollectionWidget::loadingFinished()
 	m_progress_bar->hide();
 	m_tree_view->setEnabled(true);
 
+		//Write the elements parsed during the loading to the index,
+		//the next loading read them from the index.
+		//After a reload all the element files were walked, the entries
+		//of the index not seen are the files deleted, renamed or moved.
+	if (auto cache = QETApp::collectionCache())
+	{
+		if (collections_walked) {
+			cache->pruneIndex();
+		}
+		cache->saveIndex();
+	}
+
 	if (m_loading_timer) {
 		qInfo()<<"Elements collection finished to be loaded in" << m_loading_timer->elapsed()/1000.0 << "seconds";
 		m_loading_timer.reset();
@@ -779,15 +793,8 @@ void ElementsCollectionWidget::search()
 	const QStringList text_list = text.split("+", Qt::SkipEmptyParts);
 #endif
 	QModelIndexList match_index;
-	for (QString txt : text_list) {
-		match_index << m_model->match(m_showed_index.isValid()
-						  ? m_model->index(0,0,m_showed_index)
-						  : m_model->index(0,0),
-						  Qt::UserRole+1,
-						  QVariant(txt),
-						  -1,
-						  Qt::MatchContains
-						  | Qt::MatchRecursive);
+	for (const QString &txt : text_list) {
+		match_index << m_model->search(txt, m_showed_index);
 	}
 
 	for(QModelIndex index : match_index)
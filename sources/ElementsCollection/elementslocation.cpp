@@ -25,6 +25,8 @@
 #include "../qetxml.h"
 #include "xmlelementcollection.h"
 
+#include <QDateTime>
+#include <QFileInfo>
 #include <QPicture>
 
 // make this class usable with QVariant
@@ -775,6 +777,7 @@ bool ElementsLocation::setXml(const QDomDocument &xml_document) const
 			parent_node.appendChild(xml_document
 						.documentElement()
 						.cloneNode(true));
+			emit projectCollection()->elementChanged(collectionPath(false));
 			return true;
 		}
 		//Element doesn't exist, we create the element
@@ -839,12 +842,37 @@ QUuid ElementsLocation::uuid() const
 		return QUuid();
 	}
 
+	if (m_project) {
+		return m_project->embeddedElementCollection()
+				->elementUuid(collectionPath(false));
+	}
+
+		//The uuid of an element stored in a file is memorized
+		//in the index of the collection cache, with the modification time
+		//and the size of the file, to avoid parsing the file each time.
+	const QFileInfo file_info(m_file_system_path);
+	if (!file_info.exists()) {
+		return QUuid();
+	}
+	const qint64 mtime = file_info.lastModified().toMSecsSinceEpoch();
+	const qint64 size = file_info.size();
+
+	QUuid uuid;
+	ElementsCollectionCache *cache = QETApp::collectionCache();
+	if (cache && cache->fetchUuid(m_file_system_path, mtime, size, &uuid)) {
+		return uuid;
+	}
+
 	auto document = pugiXml();
 	auto uuid_node = document.document_element().child("uuid");
-	if (uuid_node.empty()) {
-		return QUuid();
+	if (!uuid_node.empty()) {
+		uuid = QUuid(uuid_node.attribute("uuid").as_string());
+	}
+
+	if (cache) {
+		cache->cacheUuid(m_file_system_path, mtime, size, uuid);
 	}
-	return QUuid(uuid_node.attribute("uuid").as_string());
+	return uuid;
 }
 
 /**
@@ -18,11 +18,14 @@
 
 #include "fileelementcollectionitem.h"
 
+#include "../elementscollectioncache.h"
 #include "../qetapp.h"
 #include "../qeticons.h"
 #include "elementslocation.h"
 
+#include <QDateTime>
 #include <QDir>
+#include <QFileInfo>
 
 /**
 	@brief FileElementCollectionItem::FileElementCollectionItem
@@ -295,17 +298,89 @@ void FileElementCollectionItem::setUpData()
 		//Set the local name and all informations of the element
 		//in the data Qt::UserRole+1, these data will be use for search.
 		ElementsLocation loc(collectionPath());
-		DiagramContext context = loc.elementInformations();
+		const ElementsCollectionCache::IndexedElement element =
+				indexedElement(loc);
+
+		NamesList names;
+		for (auto it = element.names.constBegin() ;
+		     it != element.names.constEnd() ; ++it) {
+			names.addName(it.key(), it.value());
+		}
+		if (text().isNull()) {
+			setText(names.name(loc.fileName()));
+		}
+
 		QStringList search_list;
-		for (QString& key : context.keys())
-		{ search_list.append(context.value(key).toString()); }
-		search_list.append(localName(loc));
+		if (!element.search.isEmpty()) {
+			search_list.append(element.search);
+		}
+		search_list.append(text());
 		setData(search_list.join(" "));
 	}
 
 	setToolTip(collectionPath());
 }
 
+/**
+	@brief FileElementCollectionItem::indexedElement
+	Read the names and the informations of the element at location
+	from the index of the collection cache.
+	The file is parsed only if it was modified since it was indexed,
+	the index is then updated.
+	@param location
+	@return the indexed data of the element
+*/
+ElementsCollectionCache::IndexedElement FileElementCollectionItem::indexedElement(
+		const ElementsLocation &location) const
+{
+	ElementsCollectionCache::IndexedElement element;
+
+	const QFileInfo file_info(location.fileSystemPath());
+	const qint64 mtime = file_info.lastModified().toMSecsSinceEpoch();
+	const qint64 size = file_info.size();
+
+	ElementsCollectionCache *cache = QETApp::collectionCache();
+	if (cache && cache->fetchIndexedElement(location.fileSystemPath(),
+						mtime,
+						size,
+						&element)) {
+		return element;
+	}
+
+	const auto document = location.pugiXml();
+	const auto root = document.document_element();
+
+	NamesList names;
+	names.fromXml(root);
+	for (const QString &lang : names.langs()) {
+		element.names.insert(lang, names[lang]);
+	}
+
+	DiagramContext context;
+	context.fromXml(root.child("elementInformations"), "elementInformation");
+	QStringList search_list;
+	for (const QString &key : context.keys())
+	{
+		const QString value = context.value(key).toString();
+		element.informations.insert(key, value);
+		search_list.append(value);
+	}
+	element.search = search_list.join(" ");
+
+	const auto uuid_node = root.child("uuid");
+	if (!uuid_node.empty()) {
+		element.uuid = QUuid(uuid_node.attribute("uuid").as_string());
+	}
+
+	if (cache) {
+		cache->cacheIndexedElement(location.fileSystemPath(),
+					   mtime,
+					   size,
+					   element);
+	}
+	return element;
+}
+
 /**
 	@brief FileElementCollectionItem::setUpIcon
 	SetUp the icon of this item.
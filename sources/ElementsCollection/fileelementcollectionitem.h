@@ -18,6 +18,7 @@
 #ifndef FILEELEMENTCOLLECTIONITEM2_H
 #define FILEELEMENTCOLLECTIONITEM2_H
 
+#include "../elementscollectioncache.h"
 #include "elementcollectionitem.h"
 #include "elementslocation.h"
 
@@ -60,6 +61,8 @@ class FileElementCollectionItem : public ElementCollectionItem
 				 bool set_data = true,
 				 bool hide_element = false);
 		void populate(bool set_data = true, bool hide_element = false);
+		ElementsCollectionCache::IndexedElement indexedElement(
+				const ElementsLocation &location) const;
 
 	private:
 		QString m_path;
@@ -39,6 +39,8 @@ XmlElementCollection::XmlElementCollection(QETProject *project) :
 	QObject(project),
 	m_project(project)
 {
+	trackRevision();
+
 	QDomElement collection = m_dom_document.createElement("collection");
 	m_dom_document.appendChild(collection);
 	QDomElement import = m_dom_document.createElement("category");
@@ -174,6 +176,8 @@ XmlElementCollection::XmlElementCollection(const QDomElement &dom_element,
 	QObject(project),
 	m_project(project)
 {
+	trackRevision();
+
 	if (dom_element.tagName() == "collection")
 		m_dom_document.appendChild(m_dom_document.importNode(
 						   dom_element, true));
@@ -181,6 +185,28 @@ XmlElementCollection::XmlElementCollection(const QDomElement &dom_element,
 		qDebug() << "XmlElementCollection : tagName of dom_element is not collection";
 }
 
+/**
+	@brief XmlElementCollection::XmlElementCollection
+	Constructor with the document of a collection.
+	The tagName of the document element must be "collection"
+	@param document :
+	-the collection, the document is shared and not cloned,
+	so the caller must not modify it after.
+	@param project : the project of this collection
+*/
+XmlElementCollection::XmlElementCollection(const QDomDocument &document,
+					   QETProject *project) :
+	QObject(project),
+	m_project(project)
+{
+	trackRevision();
+
+	if (document.documentElement().tagName() == "collection")
+		m_dom_document = document;
+	else
+		qDebug() << "XmlElementCollection : tagName of dom_element is not collection";
+}
+
 /**
 	@brief XmlElementCollection::root
 	The root is the first DOM-Element the xml collection, the tag name
@@ -382,6 +408,30 @@ QDomElement XmlElementCollection::element(const QString &path) const
 		return QDomElement();
 }
 
+/**
+	@brief XmlElementCollection::elementUuid
+	The uuids are kept in an in memory index,
+	which is cleared each time the content of this collection change.
+	@param path : path of the element in this collection
+	@return the uuid of the element at path
+	or a null QUuid if not found or if the element doesn't have uuid.
+*/
+QUuid XmlElementCollection::elementUuid(const QString &path) const
+{
+	QMutexLocker locker(&m_uuids_mutex);
+	auto it = m_uuids.constFind(path);
+	if (it != m_uuids.constEnd()) {
+		return it.value();
+	}
+
+	const QUuid uuid(element(path)
+			 .firstChildElement("definition")
+			 .firstChildElement("uuid")
+			 .attribute("uuid"));
+	m_uuids.insert(path, uuid);
+	return uuid;
+}
+
 /**
 	@brief XmlElementCollection::directory
 	@param path : path of the directory in this collection
@@ -816,6 +866,38 @@ void XmlElementCollection::cleanUnusedDirectory()
 	}
 }
 
+/**
+	@brief XmlElementCollection::revision
+	@return the revision of this collection.
+	The revision is incremented each time an element
+	or a directory is added, changed or removed,
+	it can be used to know if data computed from this collection is outdated.
+*/
+quint64 XmlElementCollection::revision() const
+{
+	return m_revision;
+}
+
+/**
+	@brief XmlElementCollection::trackRevision
+	Increment the revision of this collection
+	and clear the uuid index each time the content of the collection change.
+*/
+void XmlElementCollection::trackRevision()
+{
+	auto increment = [this]()
+	{
+		++m_revision;
+		QMutexLocker locker(&m_uuids_mutex);
+		m_uuids.clear();
+	};
+	connect(this, &XmlElementCollection::elementAdded,     this, increment);
+	connect(this, &XmlElementCollection::elementChanged,   this, increment);
+	connect(this, &XmlElementCollection::elementRemoved,   this, increment);
+	connect(this, &XmlElementCollection::directorieAdded,  this, increment);
+	connect(this, &XmlElementCollection::directoryRemoved, this, increment);
+}
+
 /**
 	@brief XmlElementCollection::copyDirectory
 	Copy the directory represented by source to destination.
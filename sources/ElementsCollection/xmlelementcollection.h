@@ -20,6 +20,9 @@
 
 #include <QObject>
 #include <QDomElement>
+#include <QHash>
+#include <QMutex>
+#include <QUuid>
 #include "elementslocation.h"
 
 class QDomElement;
@@ -38,6 +41,8 @@ class XmlElementCollection : public QObject
 		XmlElementCollection (QETProject *project);
 		XmlElementCollection (const QDomElement &dom_element,
 				      QETProject *project);
+		XmlElementCollection (const QDomDocument &document,
+				      QETProject *project);
 		QDomElement root() const;
 		QDomElement importCategory() const;
 		QDomNodeList childs(const QDomElement &parent_element) const;
@@ -53,6 +58,7 @@ class XmlElementCollection : public QObject
 		QStringList elementsNames(
 				const QDomElement &parent_element) const;
 		QDomElement element(const QString &path) const;
+		QUuid elementUuid(const QString &path) const;
 		QDomElement directory(const QString &path) const;
 		QString addElement (ElementsLocation &location);
 		bool addElementDefinition (const QString &dir_path,
@@ -77,12 +83,15 @@ class XmlElementCollection : public QObject
 		void cleanUnusedElement();
 		void cleanUnusedDirectory();
 
+		quint64 revision() const;
+
 	private:
 		ElementsLocation copyDirectory(
 				ElementsLocation &source,
 				ElementsLocation &destination,
 				const QString& rename = QString(),
 				bool deep_copy = true);
+		void trackRevision();
 		ElementsLocation copyElement(ElementsLocation &source,
 					     ElementsLocation &destination,
 					     const QString& rename = QString());
@@ -122,6 +131,9 @@ class XmlElementCollection : public QObject
 	private:
 		QDomDocument m_dom_document;
 		QETProject *m_project = nullptr;
+		quint64 m_revision = 0;
+		mutable QHash<QString, QUuid> m_uuids;
+		mutable QMutex m_uuids_mutex;
 };
 
 #endif // XMLELEMENTCOLLECTION_H
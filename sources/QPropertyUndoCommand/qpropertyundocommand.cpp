@@ -16,6 +16,7 @@
 	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include "qpropertyundocommand.h"
+#include <QGraphicsItem>
 #include <QPropertyAnimation>
 
 /**
@@ -147,6 +148,21 @@ void QPropertyUndoCommand::redo()
 	QUndoCommand::redo();
 }
 
+/**
+	@brief QPropertyUndoCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool QPropertyUndoCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	if (auto diagram = DiagramsUndoCommand::diagramOf(m_object)) {
+		diagrams.insert(diagram);
+		return true;
+	}
+		//A graphics item out of a diagram isn't saved,
+		//other objects can belong to any diagram
+	return dynamic_cast<QGraphicsItem *>(m_object) != nullptr;
+}
+
 /**
 	@brief QPropertyUndoCommand::undo
 	Undo this command
@@ -18,6 +18,8 @@
 #ifndef QPROPERTYUNDOCOMMAND_H
 #define QPROPERTYUNDOCOMMAND_H
 
+#include "../undocommand/diagramsundocommand.h"
+
 #include <QUndoCommand>
 #include <QVariant>
 
@@ -30,7 +32,7 @@ class QObject;
 	To use animation call setAnimated(true). By default animation is disable.
 	Some QVariant date can't be animated and result this command don't work.
 */
-class QPropertyUndoCommand : public QUndoCommand
+class QPropertyUndoCommand : public QUndoCommand, public DiagramsUndoCommand
 {
 	public:
 		QPropertyUndoCommand(QObject *object,
@@ -52,6 +54,7 @@ class QPropertyUndoCommand : public QUndoCommand
 		bool mergeWith(const QUndoCommand *other) override;
 		void redo() override;
 		void undo() override;
+		bool changedDiagrams(QSet<Diagram *> &diagrams) const override;
 
 	private:
 		QObject *m_object = nullptr;
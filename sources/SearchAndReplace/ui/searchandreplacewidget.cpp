@@ -36,6 +36,7 @@
 #include "replacefoliowidget.h"
 #include "ui_searchandreplacewidget.h"
 
+#include <QRegularExpression>
 #include <QSettings>
 
 /**
@@ -115,6 +116,12 @@ void SearchAndReplaceWidget::clear()
 	disconnect(ui->m_tree_widget, &QTreeWidget::itemChanged,
 		   this, &SearchAndReplaceWidget::itemChanged);
 
+	for (const auto &connection : qAsConst(m_search_connections)) {
+		disconnect(connection);
+	}
+	m_search_connections.clear();
+	m_search_index.clear();
+
 	qDeleteAll(m_diagram_hash.keys());
 	m_diagram_hash.clear();
 
@@ -238,6 +245,11 @@ void SearchAndReplaceWidget::fillItemsList()
 	disconnect(ui->m_tree_widget, &QTreeWidget::itemChanged,
 		   this, &SearchAndReplaceWidget::itemChanged);
 
+	for (QTreeWidgetItem *qtwi : m_element_hash.keys())
+	{
+		m_search_index.remove(qtwi);
+		disconnect(m_search_connections.take(qtwi));
+	}
 	qDeleteAll(m_element_hash.keys());
 	m_element_hash.clear();
 
@@ -278,9 +290,12 @@ void SearchAndReplaceWidget::fillItemsList()
 
 		QTreeWidgetItem *qtwi = new QTreeWidgetItem(m_folio_qtwi);
 		qtwi->setText(0, str);
-		qtwi->setData(0, Qt::UserRole, searchTerms(diagram));
 		qtwi->setCheckState(0, Qt::Checked);
 		m_diagram_hash.insert(qtwi, QPointer<Diagram>(diagram));
+		setSearchTerms(qtwi, searchTerms(diagram));
+		m_search_connections.insert(qtwi,
+			connect(diagram, &Diagram::diagramTitleChanged,
+				this, [this, qtwi]() {updateSearchTerms(qtwi);}));
 		dc += DiagramContent(diagram, false);
 	}
 
@@ -300,8 +315,11 @@ void SearchAndReplaceWidget::fillItemsList()
 		QTreeWidgetItem *qtwi = new QTreeWidgetItem(m_indi_text_qtwi);
 		qtwi->setText(0, iti->toPlainText());
 		qtwi->setCheckState(0, Qt::Checked);
-		qtwi->setData(0, Qt::UserRole, iti->toPlainText());
 		m_text_hash.insert(qtwi, QPointer<IndependentTextItem>(iti));
+		setSearchTerms(qtwi, {iti->toPlainText()});
+		m_search_connections.insert(qtwi,
+			connect(iti, &DiagramTextItem::textEdited,
+				this, [this, qtwi]() {updateSearchTerms(qtwi);}));
 	}
 
 	m_indi_text_qtwi->sortChildren(0, Qt::AscendingOrder);
@@ -311,8 +329,11 @@ void SearchAndReplaceWidget::fillItemsList()
 		QTreeWidgetItem *qtwi = new QTreeWidgetItem(m_conductor_qtwi);
 		qtwi->setText(0, c->properties().text);
 		qtwi->setCheckState(0, Qt::Checked);
-		qtwi->setData(0, Qt::UserRole, searchTerms(c));
 		m_conductor_hash.insert(qtwi, QPointer<Conductor>(c));
+		setSearchTerms(qtwi, searchTerms(c));
+		m_search_connections.insert(qtwi,
+			connect(c, &Conductor::propertiesChange,
+				this, [this, qtwi]() {updateSearchTerms(qtwi);}));
 	}
 	m_conductor_qtwi->sortChildren(0, Qt::AscendingOrder);
 
@@ -363,7 +384,46 @@ void SearchAndReplaceWidget::addElement(Element *element)
 		str = tr("Inconnue");
 	qtwi->setText(0, str);
 	qtwi->setCheckState(0, Qt::Checked);
-	qtwi->setData(0, Qt::UserRole, searchTerms(element));
+	setSearchTerms(qtwi, searchTerms(element));
+	m_search_connections.insert(qtwi,
+		connect(element, &Element::elementInfoChange,
+			this, [this, qtwi]() {updateSearchTerms(qtwi);}));
+}
+
+/**
+	@brief SearchAndReplaceWidget::setSearchTerms
+	Store the search terms of item in the data Qt::UserRole of column 0
+	and in the search index
+	@param item
+	@param terms
+*/
+void SearchAndReplaceWidget::setSearchTerms(QTreeWidgetItem *item,
+					    const QStringList &terms)
+{
+	item->setData(0, Qt::UserRole, terms);
+	m_search_index.insert(item, terms);
+}
+
+/**
+	@brief SearchAndReplaceWidget::updateSearchTerms
+	Read again the search terms of the diagram, element,
+	text or conductor of item, when it was edited
+	@param item
+*/
+void SearchAndReplaceWidget::updateSearchTerms(QTreeWidgetItem *item)
+{
+	if (auto diagram = m_diagram_hash.value(item)) {
+		setSearchTerms(item, searchTerms(diagram.data()));
+	}
+	else if (auto element = m_element_hash.value(item)) {
+		setSearchTerms(item, searchTerms(element.data()));
+	}
+	else if (auto text = m_text_hash.value(item)) {
+		setSearchTerms(item, {text->toPlainText()});
+	}
+	else if (auto conductor = m_conductor_hash.value(item)) {
+		setSearchTerms(item, searchTerms(conductor.data()));
+	}
 }
 
 /**
@@ -396,12 +456,23 @@ void SearchAndReplaceWidget::search()
 		bool match = false;
 
 			//Extended search,
-			//on each string stored in column 0 with role : UserRole
+			//on each string stored in column 0 with role : UserRole.
+			//The search index give the items which can match,
+			//only their strings are checked.
+			//A regular expression in "entire word" mode can match
+			//anything, every item is checked.
 		QList<QTreeWidgetItem *> qtwi_list;
-		qtwi_list.append(m_diagram_hash.keys());
-		qtwi_list.append(m_element_hash.keys());
-		qtwi_list.append(m_text_hash.keys());
-		qtwi_list.append(m_conductor_hash.keys());
+		static const QRegularExpression regexp_chars("[\\\\^$.|?*+()\\[\\]{}]");
+		if (ui->m_mode_cb->currentIndex() == 0 || !str.contains(regexp_chars)) {
+			qtwi_list = m_search_index.candidates(str).values();
+		}
+		else
+		{
+			qtwi_list.append(m_diagram_hash.keys());
+			qtwi_list.append(m_element_hash.keys());
+			qtwi_list.append(m_text_hash.keys());
+			qtwi_list.append(m_conductor_hash.keys());
+		}
 		for (QTreeWidgetItem *qtwi : qtwi_list)
 		{
 			QStringList list = qtwi->data(0, Qt::UserRole)
@@ -21,6 +21,7 @@
 #include "../../QWidgetAnimation/qwidgetanimation.h"
 #include "../../qetgraphicsitem/element.h"
 #include "../../qetgraphicsitem/independenttextitem.h"
+#include "../../utils/searchindex.h"
 #include "../searchandreplaceworker.h"
 
 #include <QTreeWidgetItemIterator>
@@ -53,6 +54,8 @@ class SearchAndReplaceWidget : public QWidget
 		void setHideAdvanced(bool hide);
 		void fillItemsList();
 		void addElement(Element *element);
+		void setSearchTerms(QTreeWidgetItem *item, const QStringList &terms);
+		void updateSearchTerms(QTreeWidgetItem *item);
 		void search();
 		void setUpActions();
 		void setUpConenctions();
@@ -130,6 +133,9 @@ class SearchAndReplaceWidget : public QWidget
 		QPointer<Element> m_highlighted_element;
 		QPointer<QGraphicsObject> m_last_selected;
 		QHash<QTreeWidgetItem *, QPointer <Diagram>> m_diagram_hash;
+		SearchIndex<QTreeWidgetItem *> m_search_index;
+			///Update the search terms of each item when its object is edited
+		QHash<QTreeWidgetItem *, QMetaObject::Connection> m_search_connections;
 		SearchAndReplaceWorker m_worker;
 		QWidgetAnimation *m_vertical_animation;
 		QWidgetAnimation *m_horizontal_animation;
@@ -111,6 +111,7 @@ TerminalStripModel::TerminalStripModel(TerminalStrip *terminal_strip, QObject *p
 	fillPhysicalTerminalData();
 
 	connect(terminal_strip, &TerminalStrip::bridgeColorChanged, this, [=] {
+		m_bridge_cell_pixmap.clear();
 		emit dataChanged(index(0, LEVEL_0_CELL),
 						 index(rowCount(), LEVEL_3_CELL));
 	});
@@ -135,12 +136,7 @@ int TerminalStripModel::rowCount(const QModelIndex &parent) const
 		return 0;
 	}
 
-	auto count = 0;
-	for (const auto &mptd : m_physical_data) {
-		count += mptd.real_data.size();
-	}
-
-	return count;
+	return m_row_physical.size();
 }
 
 int TerminalStripModel::columnCount(const QModelIndex &parent) const
@@ -253,6 +249,7 @@ bool TerminalStripModel::setData(const QModelIndex &index, const QVariant &value
 	if (modified_)
 	{
 		replaceDataAtRow(mrtd, index.row());
+		m_bridge_cell_pixmap.clear();
 
 		if (mrtd.element_)
 		{
@@ -427,7 +424,14 @@ modelRealTerminalData TerminalStripModel::modelRealTerminalDataForIndex(const QM
  */
 void TerminalStripModel::buildBridgePixmap(const QSize &pixmap_size)
 {
+	if (pixmap_size == m_bridges_pixmaps_size
+			&& !m_bridges_pixmaps.isEmpty()) {
+		return;
+	}
+
 	m_bridges_pixmaps.clear();
+	m_bridge_cell_pixmap.clear();
+	m_bridges_pixmaps_size = pixmap_size;
 	for (auto color_ : TerminalStripBridge::bridgeColor())
 	{
 		QPen pen;
@@ -499,6 +503,7 @@ void TerminalStripModel::reload()
 	beginResetModel();
 	m_physical_data.clear();
 	m_modified_cell.clear();
+	m_bridge_cell_pixmap.clear();
 	fillPhysicalTerminalData();
 	endResetModel();
 }
@@ -525,30 +530,39 @@ void TerminalStripModel::fillPhysicalTerminalData()
 			m_physical_data.append(mptd);
 		}
 	}
+
+	buildRowTable();
 }
 
-modelRealTerminalData TerminalStripModel::dataAtRow(int row) const
+/**
+ * @brief TerminalStripModel::buildRowTable
+ * Build the table used to find the physical and real terminal data
+ * of a row without walking all the physical terminals.
+ * Must be called each time the layout of m_physical_data change.
+ */
+void TerminalStripModel::buildRowTable()
 {
-	if (row > rowCount(QModelIndex())) {
-		return modelRealTerminalData();
-	}
-	else
+	m_row_physical.clear();
+	m_physical_first_row.clear();
+	m_physical_first_row.reserve(m_physical_data.size());
+
+	for (int i=0 ; i<m_physical_data.size() ; ++i)
 	{
-		auto current_row = 0;
-		for (const auto &physical_data : qAsConst(m_physical_data))
-		{
-			for (const auto &real_data : physical_data.real_data)
-			{
-				if (current_row == row) {
-					return real_data;
-				} else {
-					++current_row;
-				}
-			}
+		m_physical_first_row.append(m_row_physical.size());
+		for (int j=0 ; j<m_physical_data.at(i).real_data.size() ; ++j) {
+			m_row_physical.append(i);
 		}
 	}
+}
+
+modelRealTerminalData TerminalStripModel::dataAtRow(int row) const
+{
+	if (row < 0 || row >= m_row_physical.size()) {
+		return modelRealTerminalData();
+	}
 
-	return modelRealTerminalData();
+	const auto physical_ = m_row_physical.at(row);
+	return m_physical_data.at(physical_).real_data.at(row - m_physical_first_row.at(physical_));
 }
 
 /**
@@ -559,32 +573,12 @@ modelRealTerminalData TerminalStripModel::dataAtRow(int row) const
  */
 void TerminalStripModel::replaceDataAtRow(modelRealTerminalData data, int row)
 {
-	if (row > rowCount(QModelIndex())) {
+	if (row < 0 || row >= m_row_physical.size()) {
 		return;
 	}
-	else
-	{
-		auto current_row = 0;
-		auto current_physical = 0;
 
-		for (const auto &physical_data : qAsConst(m_physical_data))
-		{
-			auto current_real = 0;
-			for (int i=0 ; i<physical_data.real_data.count() ; ++i)
-			{
-				if (current_row == row) {
-					auto physical_data = m_physical_data.at(current_physical);
-					physical_data.real_data.replace(current_real, data);
-					m_physical_data.replace(current_physical, physical_data);
-					return;
-				} else {
-					++current_real;
-					++current_row;
-				}
-			}
-			++current_physical;
-		}
-	}
+	const auto physical_ = m_row_physical.at(row);
+	m_physical_data[physical_].real_data.replace(row - m_physical_first_row.at(physical_), data);
 }
 
 /**
@@ -598,30 +592,11 @@ void TerminalStripModel::replaceDataAtRow(modelRealTerminalData data, int row)
  */
 modelPhysicalTerminalData TerminalStripModel::physicalDataAtIndex(int index) const
 {
-	if (m_physical_data.isEmpty()) {
+	if (index < 0 || index >= m_row_physical.size()) {
 		return modelPhysicalTerminalData();
 	}
 
-	int current_checked_index = -1;
-	int current_phy = -1;
-	bool match_ = false;
-
-	for (const auto &ptd_ : qAsConst(m_physical_data))
-	{
-		current_checked_index += ptd_.real_data.size();
-		++current_phy;
-
-		if (current_checked_index >= index) {
-			match_ = true;
-			break;
-		}
-	}
-
-	if (match_) {
-		return  m_physical_data.at(current_phy);
-	} else {
-		return modelPhysicalTerminalData();
-	}
+	return m_physical_data.at(m_row_physical.at(index));
 }
 
 /**
@@ -631,25 +606,15 @@ modelPhysicalTerminalData TerminalStripModel::physicalDataAtIndex(int index) con
  */
 modelRealTerminalData TerminalStripModel::realDataAtIndex(int index) const
 {
-	if (m_physical_data.isEmpty()) {
-		return modelRealTerminalData();
-	}
-
-	int current_checked_index = -1;
-
-	for (const auto & ptd_ : qAsConst(m_physical_data))
-	{
-		for (const auto & rtd_ : qAsConst(ptd_.real_data)) {
-			++current_checked_index;
-			if (current_checked_index == index) {
-				return rtd_;
-			}
-		}
-	}
-
-	return modelRealTerminalData();
+	return dataAtRow(index);
 }
 
+/**
+ * @brief TerminalStripModel::bridgePixmapFor
+ * @param index
+ * @return the pixmap of the bridge cell at \p index,
+ * the pixmap is computed once and kept until the data or the bridges change.
+ */
 QPixmap TerminalStripModel::bridgePixmapFor(const QModelIndex &index) const
 {
 	if (!index.isValid() || m_terminal_strip.isNull()) {
@@ -661,6 +626,23 @@ QPixmap TerminalStripModel::bridgePixmapFor(const QModelIndex &index) const
 		return QPixmap();
 	}
 
+	const auto key_ = qMakePair(index.row(), index.column());
+	auto it = m_bridge_cell_pixmap.constFind(key_);
+	if (it == m_bridge_cell_pixmap.constEnd()) {
+		it = m_bridge_cell_pixmap.insert(key_, computeBridgePixmap(index, level_column));
+	}
+	return it.value();
+}
+
+/**
+ * @brief TerminalStripModel::computeBridgePixmap
+ * @param index
+ * @param level_column : the level of the column of \p index
+ * @return the pixmap of the bridge cell at \p index
+ */
+QPixmap TerminalStripModel::computeBridgePixmap(const QModelIndex &index, int level_column) const
+{
+
 	auto mrtd = modelRealTerminalDataForIndex(index);
 
 		//Terminal level correspond to the column level of index
@@ -90,16 +90,22 @@ class TerminalStripModel : public QAbstractTableModel
 
 	private:
 		void fillPhysicalTerminalData();
+		void buildRowTable();
 		modelRealTerminalData dataAtRow(int row) const;
 		void replaceDataAtRow(modelRealTerminalData data, int row);
 		modelPhysicalTerminalData physicalDataAtIndex(int index) const;
 		modelRealTerminalData realDataAtIndex(int index) const;
 		QPixmap bridgePixmapFor(const QModelIndex &index) const;
+		QPixmap computeBridgePixmap(const QModelIndex &index, int level_column) const;
 
 	private:
 		QPointer<TerminalStrip> m_terminal_strip;
 		QHash<QPointer<Element>, QVector<bool>> m_modified_cell;
 		QVector<modelPhysicalTerminalData> m_physical_data;
+			///Index in m_physical_data of the physical terminal of each row
+		QVector<int> m_row_physical;
+			///First row of each physical terminal of m_physical_data
+		QVector<int> m_physical_first_row;
 		struct BridgePixmap
 		{
 				QPixmap top_,
@@ -109,6 +115,10 @@ class TerminalStripModel : public QAbstractTableModel
 		};
 
 		QHash<QColor, BridgePixmap> m_bridges_pixmaps;
+		QSize m_bridges_pixmaps_size;
+			///Pixmap of the bridge cells already painted, by row and column.
+			///Cleared when the data or the bridges change.
+		mutable QHash<QPair<int, int>, QPixmap> m_bridge_cell_pixmap;
 
 };
 
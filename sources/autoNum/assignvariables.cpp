@@ -22,6 +22,7 @@
 #include "../qetapp.h"
 #include "../qetgraphicsitem/element.h"
 #include "../qetxml.h"
+#include "../utils/formulatemplate.h"
 
 #include <QStringList>
 #include <QVariant>
@@ -209,63 +210,75 @@ namespace autonum
 	*/
 	QString AssignVariables::replaceVariable(const QString &formula,
 						 const DiagramContext &dc)
+	{
+		static const QSet<QString> keys = []()
+		{
+			QSet<QString> set;
+			for (const QString &key : variableKeys()) {
+				set.insert(key);
+			}
+			return set;
+		}();
+
+			//%{void} is always replaced by an empty string
+		if (!dc.contains(QStringLiteral("void")))
+		{
+			const QString str = FormulaTemplate::compile(formula)
+					    .evaluate(dc, keys);
+				//A value brought a new variable, see FormulaTemplate
+			if (!str.contains(QLatin1String("%{"))) {
+				return str;
+			}
+		}
+
+		return replaceVariableSequentially(formula, dc);
+	}
+
+	/**
+		@brief AssignVariables::variableKeys
+		@return the keys of the variables replaced by replaceVariable,
+		in the order of the replacement.
+	*/
+	QStringList AssignVariables::variableKeys()
+	{
+		static const QStringList keys {
+			"label", "plant", "comment", "description", "designation",
+			"manufacturer", "manufacturer_reference", "supplier",
+			"quantity", "unity",
+			"auxiliary1", "description_auxiliary1", "designation_auxiliary1",
+			"manufacturer_auxiliary1", "manufacturer_reference_auxiliary1",
+			"supplier_auxiliary1", "quantity_auxiliary1", "unity_auxiliary1",
+			"auxiliary2", "description_auxiliary2", "designation_auxiliary2",
+			"manufacturer_auxiliary2", "manufacturer_reference_auxiliary2",
+			"supplier_auxiliary2", "quantity_auxiliary2", "unity_auxiliary2",
+			"auxiliary3", "description_auxiliary3", "designation_auxiliary3",
+			"manufacturer_auxiliary3", "manufacturer_reference_auxiliary3",
+			"supplier_auxiliary3", "quantity_auxiliary3", "unity_auxiliary3",
+			"auxiliary4", "description_auxiliary4", "designation_auxiliary4",
+			"manufacturer_auxiliary4", "manufacturer_reference_auxiliary4",
+			"supplier_auxiliary4", "quantity_auxiliary4", "unity_auxiliary4",
+			"machine_manufacturer_reference", "location", "function", "void"};
+		return keys;
+	}
+
+	/**
+		@brief AssignVariables::replaceVariableSequentially
+		Replace the variables of formula one after the other.
+		Slow path of replaceVariable, used when a value contains a variable.
+		@param formula
+		@param dc
+		@return
+	*/
+	QString AssignVariables::replaceVariableSequentially(const QString &formula,
+							     const DiagramContext &dc)
 	{
 		QString str = formula;
-		str.replace("%{label}", dc.value("label").toString());
-		str.replace("%{plant}", dc.value("plant").toString());
-		str.replace("%{comment}", dc.value("comment").toString());
-		str.replace("%{description}", dc.value("description").toString());
-		str.replace("%{designation}", dc.value("designation").toString());
-		str.replace("%{manufacturer}", dc.value("manufacturer").toString());
-		str.replace("%{manufacturer_reference}",
-			    dc.value("manufacturer_reference").toString());
-		str.replace("%{supplier}", dc.value("supplier").toString());
-		str.replace("%{quantity}", dc.value("quantity").toString());
-		str.replace("%{unity}", dc.value("unity").toString());
-				str.replace("%{auxiliary1}", dc.value("auxiliary1").toString());
-		str.replace("%{description_auxiliary1}", dc.value("description_auxiliary1").toString());
-		str.replace("%{designation_auxiliary1}", dc.value("designation_auxiliary1").toString());
-		str.replace("%{manufacturer_auxiliary1}", dc.value("manufacturer_auxiliary1").toString());
-		str.replace("%{manufacturer_reference_auxiliary1}", dc.value("manufacturer_reference_auxiliary1").toString());
-		str.replace("%{supplier_auxiliary1}", dc.value("supplier_auxiliary1").toString());
-		str.replace("%{quantity_auxiliary1}", dc.value("quantity_auxiliary1").toString());
-		str.replace("%{unity_auxiliary1}", dc.value("unity_auxiliary1").toString());
-		
-		str.replace("%{auxiliary2}", dc.value("auxiliary2").toString());
-		str.replace("%{description_auxiliary2}", dc.value("description_auxiliary2").toString());
-		str.replace("%{designation_auxiliary2}", dc.value("designation_auxiliary2").toString());
-		str.replace("%{manufacturer_auxiliary2}", dc.value("manufacturer_auxiliary2").toString());
-		str.replace("%{manufacturer_reference_auxiliary2}", dc.value("manufacturer_reference_auxiliary2").toString());
-		str.replace("%{supplier_auxiliary2}", dc.value("supplier_auxiliary2").toString());
-		str.replace("%{quantity_auxiliary2}", dc.value("quantity_auxiliary2").toString());
-		str.replace("%{unity_auxiliary2}", dc.value("unity_auxiliary2").toString());
-		
-		
-		str.replace("%{auxiliary3}", dc.value("auxiliary3").toString());
-		str.replace("%{description_auxiliary3}", dc.value("description_auxiliary3").toString());
-		str.replace("%{designation_auxiliary3}", dc.value("designation_auxiliary3").toString());
-		str.replace("%{manufacturer_auxiliary3}", dc.value("manufacturer_auxiliary3").toString());
-		str.replace("%{manufacturer_reference_auxiliary3}", dc.value("manufacturer_reference_auxiliary3").toString());
-		str.replace("%{supplier_auxiliary3}", dc.value("supplier_auxiliary3").toString());
-		str.replace("%{quantity_auxiliary3}", dc.value("quantity_auxiliary3").toString());
-		str.replace("%{unity_auxiliary3}", dc.value("unity_auxiliary3").toString());
-		
-		
-		str.replace("%{auxiliary4}", dc.value("auxiliary4").toString());
-		str.replace("%{description_auxiliary4}", dc.value("description_auxiliary4").toString());
-		str.replace("%{designation_auxiliary4}", dc.value("designation_auxiliary4").toString());
-		str.replace("%{manufacturer_auxiliary4}", dc.value("manufacturer_auxiliary4").toString());
-		str.replace("%{manufacturer_reference_auxiliary4}", dc.value("manufacturer_reference_auxiliary4").toString());
-		str.replace("%{supplier_auxiliary4}", dc.value("supplier_auxiliary4").toString());
-		str.replace("%{quantity_auxiliary4}", dc.value("quantity_auxiliary4").toString());
-		str.replace("%{unity_auxiliary4}", dc.value("unity_auxiliary4").toString());
-		
-		
-		str.replace("%{machine_manufacturer_reference}",
-			    dc.value("machine_manufacturer_reference").toString());
-		str.replace("%{location}", dc.value("location").toString());
-		str.replace("%{function}", dc.value("function").toString());
-		str.replace("%{void}", QString());
+		for (const QString &key : variableKeys())
+		{
+			str.replace("%{" + key + "}",
+				    key == QLatin1String("void") ? QString()
+								 : dc.value(key).toString());
+		}
 
 		return str;
 	}
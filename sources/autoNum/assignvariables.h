@@ -64,8 +64,10 @@ namespace autonum
 			static QString formulaToLabel (QString formula, sequentialNumbers &seqStruct, Diagram *diagram, const Element *elmt = nullptr);
 			static QString replaceVariable (const QString &formula, const DiagramContext &dc);
 			static QString genericXref (const Element *element);
+			static QStringList variableKeys();
 
 		private:
+			static QString replaceVariableSequentially (const QString &formula, const DiagramContext &dc);
 			AssignVariables(const QString& formula, const sequentialNumbers& seqStruct , Diagram *diagram, const Element *elmt = nullptr);
 			void assignTitleBlockVar();
 			void assignProjectVar();
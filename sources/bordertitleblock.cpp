@@ -613,18 +613,18 @@ void BorderTitleBlock::draw(QPainter *painter)
 
 /**
 	@brief BorderTitleBlock::drawDxf
-	@param file_path
+	@param dxf : the dxf writer
 	@param color
 */
 void BorderTitleBlock::drawDxf(
-		QString &file_path,
+		Createdxf &dxf,
 		int color)
 {
 	// Transform to DXF scale.
-	columns_header_height_ *= Createdxf::yScale;
-	rows_height_           *= Createdxf::yScale;
-	rows_header_width_     *= Createdxf::xScale;
-	columns_width_         *= Createdxf::xScale;
+	columns_header_height_ *= dxf.yScale();
+	rows_height_           *= dxf.yScale();
+	rows_header_width_     *= dxf.xScale();
+	columns_width_         *= dxf.xScale();
 
 	// draw the empty box that appears as soon as there is a header
 	// dessine la case vide qui apparait des qu'il y a un entete
@@ -632,12 +632,11 @@ void BorderTitleBlock::drawDxf(
 		(display_columns_ ||
 		 display_rows_)
 		) {
-		Createdxf::drawRectangle(
-			file_path,
-			double(diagram_rect_.topLeft().x()) * Createdxf::xScale,
+		dxf.drawRectangle(
+			double(diagram_rect_.topLeft().x()) * dxf.xScale(),
 			Createdxf::sheetHeight
 					- double(diagram_rect_.topLeft().y())
-					* Createdxf::yScale
+					* dxf.yScale()
 					- columns_header_height_,
 			rows_header_width_,
 			columns_header_height_,
@@ -653,18 +652,18 @@ void BorderTitleBlock::drawDxf(
 		display_columns_) {
 	int offset = settings.value("border-columns_0", true).toBool() ? -1 : 0;
 		for (int i = 1 ; i <= columns_count_ ; ++ i) {
-	    double xCoord = diagram_rect_.topLeft().x() * Createdxf::xScale +
+	    double xCoord = diagram_rect_.topLeft().x() * dxf.xScale() +
 					(rows_header_width_ + ((i - 1) *
 					 columns_width_));
 			double yCoord = Createdxf::sheetHeight
-		    - diagram_rect_.topLeft().y()*Createdxf::yScale
+		    - diagram_rect_.topLeft().y()*dxf.yScale()
 					- columns_header_height_;
 			double recWidth = columns_width_;
 			double recHeight = columns_header_height_;
-			Createdxf::drawRectangle(file_path, xCoord, yCoord,
-						 recWidth, recHeight, color);
+			dxf.drawRectangle(xCoord, yCoord,
+					  recWidth, recHeight, color);
 
-			Createdxf::drawTextAligned(file_path,
+			dxf.drawTextAligned(
 			   QString::number(i + offset),
 			   xCoord+recWidth/4,
 			   yCoord + recHeight*0.5,
@@ -685,10 +684,10 @@ void BorderTitleBlock::drawDxf(
 		QString row_string("A");
 		for (int i = 1 ; i <= rows_count_ ; ++ i) {
 			double xCoord = diagram_rect_.topLeft().x()
-					* Createdxf::xScale;
+					* dxf.xScale();
 	    double yCoord = Createdxf::sheetHeight
 		    - diagram_rect_.topLeft().y()
-					*Createdxf::yScale
+					*dxf.yScale()
 					- (
 						columns_header_height_
 						+ ((i - 1)
@@ -696,9 +695,9 @@ void BorderTitleBlock::drawDxf(
 					- rows_height_;
 			double recWidth = rows_header_width_;
 			double recHeight = rows_height_;
-			Createdxf::drawRectangle(file_path, xCoord, yCoord,
-						 recWidth, recHeight, color);
-			Createdxf::drawTextAligned(file_path,
+			dxf.drawRectangle(xCoord, yCoord,
+					  recWidth, recHeight, color);
+			dxf.drawTextAligned(
 						   row_string,
 			   xCoord+recWidth*0.1,
 			   yCoord + recHeight*0.4,
@@ -720,16 +719,16 @@ void BorderTitleBlock::drawDxf(
 		QRectF rect = titleBlockRect();
 		m_titleblock_template_renderer -> renderDxf(rect,
 							    rect.width(),
-							    file_path,
+							    dxf,
 							    color);
 		//qp -> translate(-titleblock_rect_.topLeft());
 	}
 
 	// Transform back to QET scale
-	columns_header_height_ /= Createdxf::yScale;
-	rows_height_		   /= Createdxf::yScale;
-	rows_header_width_     /= Createdxf::xScale;
-	columns_width_         /= Createdxf::xScale;
+	columns_header_height_ /= dxf.yScale();
+	rows_height_		   /= dxf.yScale();
+	rows_header_width_     /= dxf.xScale();
+	columns_width_         /= dxf.xScale();
 
 }
 
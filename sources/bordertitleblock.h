@@ -26,6 +26,7 @@
 #include <QObject>
 #include <QRectF>
 class QPainter;
+class Createdxf;
 class DiagramPosition;
 class TitleBlockTemplate;
 class TitleBlockTemplateRenderer;
@@ -48,7 +49,7 @@ class BorderTitleBlock : public QObject
 		//METHODS
 	public:	
 		void draw(QPainter *painter);
-		void drawDxf(QString &, int);
+		void drawDxf(Createdxf &, int);
 	
 		//METHODS TO GET DIMENSION
 		//COLUMNS
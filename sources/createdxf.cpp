@@ -18,7 +18,6 @@
 #include "createdxf.h"
 #include <QFile>
 #include <QTextStream>
-#include <QMessageBox>
 #include <QString>
 #include "exportdialog.h"
 
@@ -26,284 +25,298 @@
 const double Createdxf::sheetWidth = 4000;
 const double Createdxf::sheetHeight = 2700;
 
-double Createdxf::xScale = 1;
-double Createdxf::yScale = 1;
-
-Createdxf::Createdxf()
+/**
+	@brief Createdxf::Createdxf
+	Open a writer on the file at file_path.
+	All the primitives drawn with this writer are written
+	through the same buffered stream, call close()
+	to know if the file was written correctly.
+	@param file_path
+	@param x_scale : scale from the diagram to the dxf sheet, horizontally
+	@param y_scale : scale from the diagram to the dxf sheet, vertically
+	@param mode : the open mode of the file, by default the file is truncated
+*/
+Createdxf::Createdxf(const QString &file_path,
+		     double x_scale,
+		     double y_scale,
+		     QIODevice::OpenMode mode) :
+	m_file(file_path),
+	m_x_scale(x_scale),
+	m_y_scale(y_scale)
 {
+	if (!file_path.isEmpty() && m_file.open(mode)) {
+		m_stream.setDevice(&m_file);
+	}
 }
 
+/**
+	@brief Createdxf::~Createdxf
+	Flush and close the file of this writer
+*/
 Createdxf::~Createdxf()
 {
+	close();
 }
 
-/* Header section of every DXF file.*/
-void Createdxf::dxfBegin (const QString& fileName)
+/**
+	@brief Createdxf::isOpen
+	@return true if the file of this writer is open
+*/
+bool Createdxf::isOpen() const
 {
+	return m_file.isOpen();
+}
 
-	// Creation of an output stream object in text mode.
-	// Header section of every dxf file.
-	if (!fileName.isEmpty()) {
-		QFile file(fileName);
-		if (!file.open(QFile::WriteOnly)) {
-			// error message
-			QMessageBox errorFileOpen;
-			errorFileOpen.setIcon(QMessageBox::Warning);
-			errorFileOpen.setText("Error: "+fileName+" Could Not be Opened.");
-			errorFileOpen.setInformativeText("Close all Files and Try Again.");
-			errorFileOpen.exec();
-			exit(0);
-		} else {
-			QTextStream To_Dxf(&file);
-			To_Dxf << 999           << "\r\n";
-			To_Dxf << "QET"         << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << "SECTION"     << "\r\n";
-			To_Dxf << 2             << "\r\n";
-			To_Dxf << "HEADER"      << "\r\n";
-			To_Dxf << 9             << "\r\n";
-			To_Dxf << "$ACADVER"    << "\r\n";
-			To_Dxf << 1             << "\r\n";
-			To_Dxf << "AC1006"      << "\r\n";
-			To_Dxf << 9             << "\r\n";
-			To_Dxf << "$INSBASE"    << "\r\n";
-			To_Dxf << 10            << "\r\n";
-			To_Dxf << "0.0"         << "\r\n";
-			To_Dxf << 20            << "\r\n";
-			To_Dxf << "0.0"         << "\r\n";
-			To_Dxf << 30            << "\r\n";
-			To_Dxf << "0.0"         << "\r\n";
-			To_Dxf << 9             << "\r\n";
-
-			To_Dxf << "$EXTMIN"     << "\r\n";
-			To_Dxf << 10            << "\r\n";
-			To_Dxf << "0.0"         << "\r\n";
-			To_Dxf << 20            << "\r\n";
-			To_Dxf << "0.0"         << "\r\n";
-			To_Dxf << 9             << "\r\n";
-			To_Dxf << "$EXTMAX"     << "\r\n";
-			To_Dxf << 10            << "\r\n";
-			To_Dxf << "4000.0"      << "\r\n";
-			To_Dxf << 20            << "\r\n";
-			To_Dxf << "4000.0"      << "\r\n";
-
-			To_Dxf << 9             << "\r\n";
-			To_Dxf << "$LIMMIN"     << "\r\n";
-			To_Dxf << 10            << "\r\n";
-			To_Dxf << "0.0"         << "\r\n";
-			To_Dxf << 20            << "\r\n";
-			To_Dxf << "0.0"         << "\r\n";
-			To_Dxf << 9             << "\r\n";
-			To_Dxf << "$LIMMAX"     << "\r\n";
-			To_Dxf << 10            << "\r\n";
-			To_Dxf << "4000.0"      << "\r\n";
-			To_Dxf << 20            << "\r\n";
-			To_Dxf << "4000.0"      << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << "ENDSEC"      << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << "SECTION"     << "\r\n";
-			To_Dxf << 2             << "\r\n";
-			To_Dxf << "TABLES"      << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << "TABLE"       << "\r\n";
-			To_Dxf << 2             << "\r\n";
-
-			To_Dxf << "VPORT"       << "\r\n";
-			To_Dxf << 70            << "\r\n";
-			To_Dxf << 1             << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << "VPORT"       << "\r\n";
-			To_Dxf << 2             << "\r\n";
-			To_Dxf << "*ACTIVE"     << "\r\n";
-			To_Dxf << 70            << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << 10            << "\r\n";
-			To_Dxf << 0.0           << "\r\n";
-			To_Dxf << 20            << "\r\n";
-			To_Dxf << 0.0           << "\r\n";
-			To_Dxf << 11            << "\r\n";
-			To_Dxf << 1.0           << "\r\n";
-			To_Dxf << 21            << "\r\n";
-			To_Dxf << 1.0           << "\r\n";
-			To_Dxf << 12            << "\r\n";
-			To_Dxf << 2000          << "\r\n";
-			To_Dxf << 22            << "\r\n";
-			To_Dxf << 1350          << "\r\n";
-			To_Dxf << 13            << "\r\n";
-			To_Dxf << 0.0           << "\r\n";
-			To_Dxf << 23            << "\r\n";
-			To_Dxf << 0.0           << "\r\n";
-			To_Dxf << 14            << "\r\n";
-			To_Dxf << 1.0           << "\r\n";
-			To_Dxf << 24            << "\r\n";
-			To_Dxf << 1.0           << "\r\n";
-			To_Dxf << 15            << "\r\n";
-			To_Dxf << 0.0           << "\r\n";
-			To_Dxf << 25            << "\r\n";
-			To_Dxf << 0.0           << "\r\n";
-			To_Dxf << 16            << "\r\n";
-			To_Dxf << 0.0           << "\r\n";
-			To_Dxf << 26            << "\r\n";
-			To_Dxf << 0.0           << "\r\n";
-			To_Dxf << 36            << "\r\n";
-			To_Dxf << 1.0           << "\r\n";
-			To_Dxf << 17            << "\r\n";
-			To_Dxf << 0.0           << "\r\n";
-			To_Dxf << 27            << "\r\n";
-			To_Dxf << 0.0           << "\r\n";
-			To_Dxf << 37            << "\r\n";
-			To_Dxf << 0.0           << "\r\n";
-			To_Dxf << 40            << "\r\n";
-			To_Dxf << 2732.5        << "\r\n";
-			To_Dxf << 41            << "\r\n";
-			To_Dxf << 2.558         << "\r\n";
-			To_Dxf << 42            << "\r\n";
-			To_Dxf << 50.0          << "\r\n";
-			To_Dxf << 43            << "\r\n";
-			To_Dxf << 0.0           << "\r\n";
-			To_Dxf << 44            << "\r\n";
-			To_Dxf << 0.0           << "\r\n";
-			To_Dxf << 50            << "\r\n";
-			To_Dxf << 0.0           << "\r\n";
-			To_Dxf << 51            << "\r\n";
-			To_Dxf << 0.0           << "\r\n";
-			To_Dxf << 71            << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << 72            << "\r\n";
-			To_Dxf << 100           << "\r\n";
-			To_Dxf << 73            << "\r\n";
-			To_Dxf << 1             << "\r\n";
-			To_Dxf << 74            << "\r\n";
-			To_Dxf << 1             << "\r\n";
-			To_Dxf << 75            << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << 76            << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << 77            << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << 78            << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << "ENDTAB"      << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << "TABLE"       << "\r\n";
-			To_Dxf << 2             << "\r\n";
-
-			To_Dxf << "LTYPE"       << "\r\n";
-			To_Dxf << 70            << "\r\n";
-			To_Dxf << 1             << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << "LTYPE"       << "\r\n";
-			To_Dxf << 2             << "\r\n";
-			To_Dxf << "CONTINUOUS"  << "\r\n";
-			To_Dxf << 70            << "\r\n";
-			To_Dxf << 64            << "\r\n";
-			To_Dxf << 3             << "\r\n";
-			To_Dxf << "Solid Line"  << "\r\n";
-			To_Dxf << 72            << "\r\n";
-			To_Dxf << 65            << "\r\n";
-			To_Dxf << 73            << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << 40            << "\r\n";
-			To_Dxf << 0.00          << "\r\n";
-			To_Dxf << 0             << "\r\n";
-
-			To_Dxf << "ENDTAB"      << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << "ENDSEC"      << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << "SECTION"     << "\r\n";
-			To_Dxf << 2             << "\r\n";
-			To_Dxf << "BLOCKS"      << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << "ENDSEC"      << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << "SECTION"     << "\r\n";
-			To_Dxf << 2             << "\r\n";
-			To_Dxf << "ENTITIES"    << "\r\n";
-			file.close();
-		}
+/**
+	@brief Createdxf::close
+	Flush and close the file of this writer
+	@return true if the file was opened and written without error
+*/
+bool Createdxf::close()
+{
+	if (!isOpen()) {
+		return false;
+	}
+
+	m_stream.flush();
+	m_file.close();
+	return m_stream.status() == QTextStream::Ok
+			&& m_file.error() == QFileDevice::NoError;
+}
+
+/* Header section of every DXF file.*/
+void Createdxf::dxfBegin()
+{
+	if (!isOpen()) {
+		return;
 	}
+
+	QTextStream &To_Dxf = m_stream;
+	To_Dxf << 999           << "\r\n";
+	To_Dxf << "QET"         << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << "SECTION"     << "\r\n";
+	To_Dxf << 2             << "\r\n";
+	To_Dxf << "HEADER"      << "\r\n";
+	To_Dxf << 9             << "\r\n";
+	To_Dxf << "$ACADVER"    << "\r\n";
+	To_Dxf << 1             << "\r\n";
+	To_Dxf << "AC1006"      << "\r\n";
+	To_Dxf << 9             << "\r\n";
+	To_Dxf << "$INSBASE"    << "\r\n";
+	To_Dxf << 10            << "\r\n";
+	To_Dxf << "0.0"         << "\r\n";
+	To_Dxf << 20            << "\r\n";
+	To_Dxf << "0.0"         << "\r\n";
+	To_Dxf << 30            << "\r\n";
+	To_Dxf << "0.0"         << "\r\n";
+	To_Dxf << 9             << "\r\n";
+
+	To_Dxf << "$EXTMIN"     << "\r\n";
+	To_Dxf << 10            << "\r\n";
+	To_Dxf << "0.0"         << "\r\n";
+	To_Dxf << 20            << "\r\n";
+	To_Dxf << "0.0"         << "\r\n";
+	To_Dxf << 9             << "\r\n";
+	To_Dxf << "$EXTMAX"     << "\r\n";
+	To_Dxf << 10            << "\r\n";
+	To_Dxf << "4000.0"      << "\r\n";
+	To_Dxf << 20            << "\r\n";
+	To_Dxf << "4000.0"      << "\r\n";
+
+	To_Dxf << 9             << "\r\n";
+	To_Dxf << "$LIMMIN"     << "\r\n";
+	To_Dxf << 10            << "\r\n";
+	To_Dxf << "0.0"         << "\r\n";
+	To_Dxf << 20            << "\r\n";
+	To_Dxf << "0.0"         << "\r\n";
+	To_Dxf << 9             << "\r\n";
+	To_Dxf << "$LIMMAX"     << "\r\n";
+	To_Dxf << 10            << "\r\n";
+	To_Dxf << "4000.0"      << "\r\n";
+	To_Dxf << 20            << "\r\n";
+	To_Dxf << "4000.0"      << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << "ENDSEC"      << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << "SECTION"     << "\r\n";
+	To_Dxf << 2             << "\r\n";
+	To_Dxf << "TABLES"      << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << "TABLE"       << "\r\n";
+	To_Dxf << 2             << "\r\n";
+
+	To_Dxf << "VPORT"       << "\r\n";
+	To_Dxf << 70            << "\r\n";
+	To_Dxf << 1             << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << "VPORT"       << "\r\n";
+	To_Dxf << 2             << "\r\n";
+	To_Dxf << "*ACTIVE"     << "\r\n";
+	To_Dxf << 70            << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << 10            << "\r\n";
+	To_Dxf << 0.0           << "\r\n";
+	To_Dxf << 20            << "\r\n";
+	To_Dxf << 0.0           << "\r\n";
+	To_Dxf << 11            << "\r\n";
+	To_Dxf << 1.0           << "\r\n";
+	To_Dxf << 21            << "\r\n";
+	To_Dxf << 1.0           << "\r\n";
+	To_Dxf << 12            << "\r\n";
+	To_Dxf << 2000          << "\r\n";
+	To_Dxf << 22            << "\r\n";
+	To_Dxf << 1350          << "\r\n";
+	To_Dxf << 13            << "\r\n";
+	To_Dxf << 0.0           << "\r\n";
+	To_Dxf << 23            << "\r\n";
+	To_Dxf << 0.0           << "\r\n";
+	To_Dxf << 14            << "\r\n";
+	To_Dxf << 1.0           << "\r\n";
+	To_Dxf << 24            << "\r\n";
+	To_Dxf << 1.0           << "\r\n";
+	To_Dxf << 15            << "\r\n";
+	To_Dxf << 0.0           << "\r\n";
+	To_Dxf << 25            << "\r\n";
+	To_Dxf << 0.0           << "\r\n";
+	To_Dxf << 16            << "\r\n";
+	To_Dxf << 0.0           << "\r\n";
+	To_Dxf << 26            << "\r\n";
+	To_Dxf << 0.0           << "\r\n";
+	To_Dxf << 36            << "\r\n";
+	To_Dxf << 1.0           << "\r\n";
+	To_Dxf << 17            << "\r\n";
+	To_Dxf << 0.0           << "\r\n";
+	To_Dxf << 27            << "\r\n";
+	To_Dxf << 0.0           << "\r\n";
+	To_Dxf << 37            << "\r\n";
+	To_Dxf << 0.0           << "\r\n";
+	To_Dxf << 40            << "\r\n";
+	To_Dxf << 2732.5        << "\r\n";
+	To_Dxf << 41            << "\r\n";
+	To_Dxf << 2.558         << "\r\n";
+	To_Dxf << 42            << "\r\n";
+	To_Dxf << 50.0          << "\r\n";
+	To_Dxf << 43            << "\r\n";
+	To_Dxf << 0.0           << "\r\n";
+	To_Dxf << 44            << "\r\n";
+	To_Dxf << 0.0           << "\r\n";
+	To_Dxf << 50            << "\r\n";
+	To_Dxf << 0.0           << "\r\n";
+	To_Dxf << 51            << "\r\n";
+	To_Dxf << 0.0           << "\r\n";
+	To_Dxf << 71            << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << 72            << "\r\n";
+	To_Dxf << 100           << "\r\n";
+	To_Dxf << 73            << "\r\n";
+	To_Dxf << 1             << "\r\n";
+	To_Dxf << 74            << "\r\n";
+	To_Dxf << 1             << "\r\n";
+	To_Dxf << 75            << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << 76            << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << 77            << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << 78            << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << "ENDTAB"      << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << "TABLE"       << "\r\n";
+	To_Dxf << 2             << "\r\n";
+
+	To_Dxf << "LTYPE"       << "\r\n";
+	To_Dxf << 70            << "\r\n";
+	To_Dxf << 1             << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << "LTYPE"       << "\r\n";
+	To_Dxf << 2             << "\r\n";
+	To_Dxf << "CONTINUOUS"  << "\r\n";
+	To_Dxf << 70            << "\r\n";
+	To_Dxf << 64            << "\r\n";
+	To_Dxf << 3             << "\r\n";
+	To_Dxf << "Solid Line"  << "\r\n";
+	To_Dxf << 72            << "\r\n";
+	To_Dxf << 65            << "\r\n";
+	To_Dxf << 73            << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << 40            << "\r\n";
+	To_Dxf << 0.00          << "\r\n";
+	To_Dxf << 0             << "\r\n";
+
+	To_Dxf << "ENDTAB"      << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << "ENDSEC"      << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << "SECTION"     << "\r\n";
+	To_Dxf << 2             << "\r\n";
+	To_Dxf << "BLOCKS"      << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << "ENDSEC"      << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << "SECTION"     << "\r\n";
+	To_Dxf << 2             << "\r\n";
+	To_Dxf << "ENTITIES"    << "\r\n";
 }
 
 /**
 	@brief Createdxf::dxfEnd
 	End Section of every DXF File
-	@param fileName
 */
-void Createdxf::dxfEnd(const QString& fileName)
+void Createdxf::dxfEnd()
 {
-	// Creation of an output stream object in text mode.
-	if (!fileName.isEmpty()) {
-		QFile file(fileName);
-		if (!file.open(QFile::Append)) {
-			// error message
-			QMessageBox errorFileOpen;
-			errorFileOpen.setText("Error: File "+fileName+" was not written correctly.");
-			errorFileOpen.setInformativeText("Close all Files and Re-Run");
-			errorFileOpen.exec();
-		} else {
-			QTextStream To_Dxf(&file);
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << "ENDSEC"      << "\r\n";
-			To_Dxf << 0             << "\r\n";
-			To_Dxf << "EOF";
-			file.close();
-		}
+	if (!isOpen()) {
+		return;
 	}
+
+	QTextStream &To_Dxf = m_stream;
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << "ENDSEC"      << "\r\n";
+	To_Dxf << 0             << "\r\n";
+	To_Dxf << "EOF";
 }
 
 /**
 	@brief Createdxf::drawCircle
 	draw circle in dxf format
-	@param fileName
 	@param radius
 	@param x
 	@param y
 	@param colour
 */
 void Createdxf::drawCircle(
-		const QString& fileName,
 		double radius,
 		double x,
 		double y,
 		int colour)
 {
-	if (!fileName.isEmpty()) {
-		QFile file(fileName);
-		if (!file.open(QFile::Append)) {
-			// error message
-			QMessageBox errorFileOpen;
-			errorFileOpen.setText("Error: File "+fileName+" was not written correctly.");
-			errorFileOpen.setInformativeText("Close all Files and Re-Run");
-			errorFileOpen.exec();
-		} else {
-			QTextStream To_Dxf(&file);
-			// Draw the circle
-			To_Dxf << 0         << "\r\n";
-			To_Dxf << "CIRCLE"  << "\r\n";
-			To_Dxf << 8         << "\r\n";
-			To_Dxf << 0         << "\r\n";    // Layer number (default layer in autocad)
-			To_Dxf << 62        << "\r\n";
-			To_Dxf << colour    << "\r\n";    // Colour Code
-			To_Dxf << 10        << "\r\n";    // XYZ is the Center point of circle
-			To_Dxf << x         << "\r\n";    // X in UCS (User Coordinate System)coordinates
-			To_Dxf << 20        << "\r\n";
-			To_Dxf << y         << "\r\n";    // Y in UCS (User Coordinate System)coordinates
-			To_Dxf << 30        << "\r\n";
-			To_Dxf << 0.0       << "\r\n";    // Z in UCS (User Coordinate System)coordinates
-			To_Dxf << 40        << "\r\n";
-			To_Dxf << radius    << "\r\n";    // radius of circle
-			file.close();
-		}
+	if (!isOpen()) {
+		return;
 	}
+
+	QTextStream &To_Dxf = m_stream;
+	// Draw the circle
+	To_Dxf << 0         << "\r\n";
+	To_Dxf << "CIRCLE"  << "\r\n";
+	To_Dxf << 8         << "\r\n";
+	To_Dxf << 0         << "\r\n";    // Layer number (default layer in autocad)
+	To_Dxf << 62        << "\r\n";
+	To_Dxf << colour    << "\r\n";    // Colour Code
+	To_Dxf << 10        << "\r\n";    // XYZ is the Center point of circle
+	To_Dxf << x         << "\r\n";    // X in UCS (User Coordinate System)coordinates
+	To_Dxf << 20        << "\r\n";
+	To_Dxf << y         << "\r\n";    // Y in UCS (User Coordinate System)coordinates
+	To_Dxf << 30        << "\r\n";
+	To_Dxf << 0.0       << "\r\n";    // Z in UCS (User Coordinate System)coordinates
+	To_Dxf << 40        << "\r\n";
+	To_Dxf << radius    << "\r\n";    // radius of circle
 }
 
 /**
 	@brief Createdxf::drawLine
 	draw line in DXF Format
-	@param fileName
 	@param x1
 	@param y1
 	@param x2
@@ -311,45 +324,36 @@ void Createdxf::drawCircle(
 	@param colour
 */
 void Createdxf::drawLine (
-		const QString &fileName,
 		double x1,
 		double y1,
 		double x2,
 		double y2,
 		const int &colour)
 {
-	if (!fileName.isEmpty()) {
-		QFile file(fileName);
-		if (!file.open(QFile::Append)) {
-			// error message
-			QMessageBox errorFileOpen;
-			errorFileOpen.setText("Error: File "+fileName+" was not written correctly.");
-			errorFileOpen.setInformativeText("Close all Files and Re-Run");
-			errorFileOpen.exec();
-		} else {
-			QTextStream To_Dxf(&file);
-			// Draw the Line
-			To_Dxf << 0         << "\r\n";
-			To_Dxf << "LINE"    << "\r\n";
-			To_Dxf << 8         << "\r\n";
-			To_Dxf << 0         << "\r\n";    // Layer number (default layer in autocad)
-			To_Dxf << 62        << "\r\n";
-			To_Dxf << colour    << "\r\n";    // Colour Code
-			To_Dxf << 10        << "\r\n";
-			To_Dxf << x1        << "\r\n";    // X in UCS (User Coordinate System)coordinates
-			To_Dxf << 20        << "\r\n";
-			To_Dxf << y1        << "\r\n";    // Y in UCS (User Coordinate System)coordinates
-			To_Dxf << 30        << "\r\n";
-			To_Dxf << 0.0       << "\r\n";    // Z in UCS (User Coordinate System)coordinates
-			To_Dxf << 11        << "\r\n";
-			To_Dxf << x2        << "\r\n";    // X in UCS (User Coordinate System)coordinates
-			To_Dxf << 21        << "\r\n";
-			To_Dxf << y2        << "\r\n";    // Y in UCS (User Coordinate System)coordinates
-			To_Dxf << 31        << "\r\n";
-			To_Dxf << 0.0       << "\r\n";    // Z in UCS (User Coordinate System)coordinates
-			file.close();
-		}
+	if (!isOpen()) {
+		return;
 	}
+
+	QTextStream &To_Dxf = m_stream;
+	// Draw the Line
+	To_Dxf << 0         << "\r\n";
+	To_Dxf << "LINE"    << "\r\n";
+	To_Dxf << 8         << "\r\n";
+	To_Dxf << 0         << "\r\n";    // Layer number (default layer in autocad)
+	To_Dxf << 62        << "\r\n";
+	To_Dxf << colour    << "\r\n";    // Colour Code
+	To_Dxf << 10        << "\r\n";
+	To_Dxf << x1        << "\r\n";    // X in UCS (User Coordinate System)coordinates
+	To_Dxf << 20        << "\r\n";
+	To_Dxf << y1        << "\r\n";    // Y in UCS (User Coordinate System)coordinates
+	To_Dxf << 30        << "\r\n";
+	To_Dxf << 0.0       << "\r\n";    // Z in UCS (User Coordinate System)coordinates
+	To_Dxf << 11        << "\r\n";
+	To_Dxf << x2        << "\r\n";    // X in UCS (User Coordinate System)coordinates
+	To_Dxf << 21        << "\r\n";
+	To_Dxf << y2        << "\r\n";    // Y in UCS (User Coordinate System)coordinates
+	To_Dxf << 31        << "\r\n";
+	To_Dxf << 0.0       << "\r\n";    // Z in UCS (User Coordinate System)coordinates
 }
 
 long Createdxf::RGBcodeTable[255]
@@ -447,7 +451,6 @@ int Createdxf::dxfColor(QPen pen) {
 }
 
 void Createdxf::drawArcEllipse(
-		const QString &file_path,
 		qreal x,
 		qreal y,
 		qreal w,
@@ -583,7 +586,6 @@ void Createdxf::drawArcEllipse(
 		arc_startAngle -= rotation_angle;
 
 		drawArc(
-					file_path,
 					center_x,
 					center_y,
 					radius,
@@ -598,7 +600,6 @@ void Createdxf::drawArcEllipse(
 /**
 	@brief Createdxf::drawRectangle
 	draw rectangle in dxf format
-	@param fileName
 	@param x1
 	@param y1
 	@param width
@@ -606,7 +607,6 @@ void Createdxf::drawArcEllipse(
 	@param colour
 */
 void Createdxf::drawRectangle (
-		const QString &fileName,
 		double x1,
 		double y1,
 		double width,
@@ -615,18 +615,12 @@ void Createdxf::drawRectangle (
 {
 	QRectF rect(x1,y1,width,height);
 	QPolygonF poly(rect);
-	drawPolyline(fileName,poly,colour,true);
+	drawPolyline(poly,colour,true);
 }
 
-
-
-
-
-
 /**
 	@brief Createdxf::drawArc
 	draw arc in dx format
-	@param fileName
 	@param x
 	@param y
 	@param rad
@@ -635,7 +629,6 @@ void Createdxf::drawRectangle (
 	@param color
 */
 void Createdxf::drawArc(
-		const QString& fileName,
 		double x,
 		double y,
 		double rad,
@@ -643,44 +636,35 @@ void Createdxf::drawArc(
 		double endAngle,
 		int color)
 {
-	if (!fileName.isEmpty()) {
-		QFile file(fileName);
-		if (!file.open(QFile::Append)) {
-			// error message
-			QMessageBox errorFileOpen;
-			errorFileOpen.setText("Error: File "+fileName+" was not written correctly.");
-			errorFileOpen.setInformativeText("Close all Files and Re-Run");
-			errorFileOpen.exec();
-		} else {
-			QTextStream To_Dxf(&file);
-			// Draw the arc
-			To_Dxf << 0         << "\r\n";
-			To_Dxf << "ARC"     << "\r\n";
-			To_Dxf << 8         << "\r\n";
-			To_Dxf << 0         << "\r\n";    // Layer number (default layer in autocad)
-			To_Dxf << 62        << "\r\n";
-			To_Dxf << color     << "\r\n";    // Colour Code
-			To_Dxf << 10        << "\r\n";    // XYZ is the Center point of circle
-			To_Dxf << x         << "\r\n";    // X in UCS (User Coordinate System)coordinates
-			To_Dxf << 20        << "\r\n";
-			To_Dxf << y         << "\r\n";    // Y in UCS (User Coordinate System)coordinates
-			To_Dxf << 30        << "\r\n";
-			To_Dxf << 0.0       << "\r\n";    // Z in UCS (User Coordinate System)coordinates
-			To_Dxf << 40        << "\r\n";
-			To_Dxf << rad       << "\r\n";    // radius of arc
-			To_Dxf << 50        << "\r\n";
-			To_Dxf << startAngle<< "\r\n";    // start angle
-			To_Dxf << 51        << "\r\n";
-			To_Dxf << endAngle  << "\r\n";    // end angle
-			file.close();
-		}
+	if (!isOpen()) {
+		return;
 	}
+
+	QTextStream &To_Dxf = m_stream;
+	// Draw the arc
+	To_Dxf << 0         << "\r\n";
+	To_Dxf << "ARC"     << "\r\n";
+	To_Dxf << 8         << "\r\n";
+	To_Dxf << 0         << "\r\n";    // Layer number (default layer in autocad)
+	To_Dxf << 62        << "\r\n";
+	To_Dxf << color     << "\r\n";    // Colour Code
+	To_Dxf << 10        << "\r\n";    // XYZ is the Center point of circle
+	To_Dxf << x         << "\r\n";    // X in UCS (User Coordinate System)coordinates
+	To_Dxf << 20        << "\r\n";
+	To_Dxf << y         << "\r\n";    // Y in UCS (User Coordinate System)coordinates
+	To_Dxf << 30        << "\r\n";
+	To_Dxf << 0.0       << "\r\n";    // Z in UCS (User Coordinate System)coordinates
+	To_Dxf << 40        << "\r\n";
+	To_Dxf << rad       << "\r\n";    // radius of arc
+	To_Dxf << 50        << "\r\n";
+	To_Dxf << startAngle<< "\r\n";    // start angle
+	To_Dxf << 51        << "\r\n";
+	To_Dxf << endAngle  << "\r\n";    // end angle
 }
 
 /**
 	@brief Createdxf::drawText
 	draw simple text in dxf format without any alignment specified
-	@param fileName
 	@param text
 	@param x
 	@param y
@@ -690,7 +674,6 @@ void Createdxf::drawArc(
 	@param xScaleW = 1
 */
 void Createdxf::drawText(
-	const QString& fileName,
 	const QString& text,
 	double x,
 	double y,
@@ -699,47 +682,38 @@ void Createdxf::drawText(
 	int colour,
 	double xScaleW)
 {
-	if (!fileName.isEmpty()) {
-	QFile file(fileName);
-	if (!file.open(QFile::Append)) {
-		// error message
-		QMessageBox errorFileOpen;
-		errorFileOpen.setText("Error: File "+fileName+" was not written correctly.");
-		errorFileOpen.setInformativeText("Close all Files and Re-Run");
-		errorFileOpen.exec();
-	} else {
-		QTextStream To_Dxf(&file);
-		// Draw the text
-		To_Dxf << 0         << "\r\n";
-		To_Dxf << "TEXT"    << "\r\n";
-		To_Dxf << 8         << "\r\n";
-		To_Dxf << 0         << "\r\n";    // Layer number (default layer in autocad)
-		To_Dxf << 62        << "\r\n";
-		To_Dxf << colour    << "\r\n";    // Colour Code
-		To_Dxf << 10        << "\r\n";    // XYZ
-		To_Dxf << x         << "\r\n";    // X in UCS (User Coordinate System)coordinates
-		To_Dxf << 20        << "\r\n";
-		To_Dxf << y         << "\r\n";    // Y in UCS (User Coordinate System)coordinates
-		To_Dxf << 30        << "\r\n";
-		To_Dxf << 0.0       << "\r\n";    // Z in UCS (User Coordinate System)coordinates
-		To_Dxf << 40        << "\r\n";
-		To_Dxf << height    << "\r\n";    // Text Height
-		To_Dxf << 41        << "\r\n";
-		To_Dxf << xScaleW    << "\r\n";    // X Scale
-		To_Dxf << 1         << "\r\n";
-		To_Dxf << text      << "\r\n";    // Text Value
-		To_Dxf << 50        << "\r\n";
-		To_Dxf << rotation  << "\r\n";    // Text Rotation
-		file.close();
-	}
+	if (!isOpen()) {
+		return;
 	}
+
+	QTextStream &To_Dxf = m_stream;
+	// Draw the text
+	To_Dxf << 0         << "\r\n";
+	To_Dxf << "TEXT"    << "\r\n";
+	To_Dxf << 8         << "\r\n";
+	To_Dxf << 0         << "\r\n";    // Layer number (default layer in autocad)
+	To_Dxf << 62        << "\r\n";
+	To_Dxf << colour    << "\r\n";    // Colour Code
+	To_Dxf << 10        << "\r\n";    // XYZ
+	To_Dxf << x         << "\r\n";    // X in UCS (User Coordinate System)coordinates
+	To_Dxf << 20        << "\r\n";
+	To_Dxf << y         << "\r\n";    // Y in UCS (User Coordinate System)coordinates
+	To_Dxf << 30        << "\r\n";
+	To_Dxf << 0.0       << "\r\n";    // Z in UCS (User Coordinate System)coordinates
+	To_Dxf << 40        << "\r\n";
+	To_Dxf << height    << "\r\n";    // Text Height
+	To_Dxf << 41        << "\r\n";
+	To_Dxf << xScaleW    << "\r\n";    // X Scale
+	To_Dxf << 1         << "\r\n";
+	To_Dxf << text      << "\r\n";    // Text Value
+	To_Dxf << 50        << "\r\n";
+	To_Dxf << rotation  << "\r\n";    // Text Rotation
 }
 
 /* draw aligned text in DXF Format */
 // leftAlign flag added. If the alignment requested is 'fit to width' and the text length is very small,
 // then the text is either centered or left-aligned, depnding on the value of leftAlign.
 void Createdxf::drawTextAligned(
-		const QString& fileName,
 		const QString& text,
 		double x,
 		double y,
@@ -752,146 +726,128 @@ void Createdxf::drawTextAligned(
 	double xScaleW,
 		int colour)
 {
-	if (!fileName.isEmpty()) {
-		QFile file(fileName);
-		if (!file.open(QFile::Append)) {
-			// error message
-			QMessageBox errorFileOpen;
-			errorFileOpen.setText("Error: File "+fileName+" was not written correctly.");
-			errorFileOpen.setInformativeText("Close all Files and Re-Run");
-			errorFileOpen.exec();
-		} else {
-			QTextStream To_Dxf(&file);
-			// Draw the circle
-			To_Dxf << 0         << "\r\n";
-			To_Dxf << "TEXT"    << "\r\n";
-			To_Dxf << 8         << "\r\n";
-			To_Dxf << 0         << "\r\n";    // Layer number (default layer in autocad)
-			To_Dxf << 62        << "\r\n";
-			To_Dxf << colour    << "\r\n";    // Colour Code
-			To_Dxf << 10        << "\r\n";    // XYZ
-			To_Dxf << x         << "\r\n";    // X in UCS (User Coordinate System)coordinates
-			To_Dxf << 20        << "\r\n";
-			To_Dxf << y         << "\r\n";    // Y in UCS (User Coordinate System)coordinates
-			To_Dxf << 30        << "\r\n";
-			To_Dxf << 0.0       << "\r\n";    // Z in UCS (User Coordinate System)coordinates
-			To_Dxf << 40        << "\r\n";
-			To_Dxf << height    << "\r\n";    // Text Height
-			To_Dxf << 41        << "\r\n";
-		To_Dxf << xScaleW    << "\r\n";    // X Scale
-			To_Dxf << 1         << "\r\n";
-			To_Dxf << text      << "\r\n";    // Text Value
-			To_Dxf << 50        << "\r\n";
-			To_Dxf << rotation  << "\r\n";    // Text Rotation
+	if (!isOpen()) {
+		return;
+	}
+
+	QTextStream &To_Dxf = m_stream;
+	// Draw the circle
+	To_Dxf << 0         << "\r\n";
+	To_Dxf << "TEXT"    << "\r\n";
+	To_Dxf << 8         << "\r\n";
+	To_Dxf << 0         << "\r\n";    // Layer number (default layer in autocad)
+	To_Dxf << 62        << "\r\n";
+	To_Dxf << colour    << "\r\n";    // Colour Code
+	To_Dxf << 10        << "\r\n";    // XYZ
+	To_Dxf << x         << "\r\n";    // X in UCS (User Coordinate System)coordinates
+	To_Dxf << 20        << "\r\n";
+	To_Dxf << y         << "\r\n";    // Y in UCS (User Coordinate System)coordinates
+	To_Dxf << 30        << "\r\n";
+	To_Dxf << 0.0       << "\r\n";    // Z in UCS (User Coordinate System)coordinates
+	To_Dxf << 40        << "\r\n";
+	To_Dxf << height    << "\r\n";    // Text Height
+	To_Dxf << 41        << "\r\n";
+To_Dxf << xScaleW    << "\r\n";    // X Scale
+	To_Dxf << 1         << "\r\n";
+	To_Dxf << text      << "\r\n";    // Text Value
+	To_Dxf << 50        << "\r\n";
+	To_Dxf << rotation  << "\r\n";    // Text Rotation
 #if 0
-			// If "Fit to width", then check if width of text < width specified then change it "center align or left align"
-			if (hAlign == 5) {
-				int xDiff = xAlign - x;
-				int len = text.length();
-				int t = xDiff/height;
-				if (text.length() < xDiff/height && !leftAlign) {
-					hAlign = 1;
-					xAlign = x+ (xAlign / 2);
-				} else if (text.length() < xDiff/height && leftAlign) {
-					hAlign = 0;
-					xAlign = x;
+	// If "Fit to width", then check if width of text < width specified then change it "center align or left align"
+	if (hAlign == 5) {
+		int xDiff = xAlign - x;
+		int len = text.length();
+		int t = xDiff/height;
+		if (text.length() < xDiff/height && !leftAlign) {
+			hAlign = 1;
+			xAlign = x+ (xAlign / 2);
+		} else if (text.length() < xDiff/height && leftAlign) {
+			hAlign = 0;
+			xAlign = x;
 //					file.close();
 //					return;
-				}
-			}
-#endif
-			To_Dxf << 51        << "\r\n";
-			To_Dxf << oblique   << "\r\n";    // Text Obliqueness
-			To_Dxf << 72        << "\r\n";
-			To_Dxf << hAlign    << "\r\n";    // Text Horizontal Alignment
-			To_Dxf << 73        << "\r\n";
-			To_Dxf << vAlign    << "\r\n";    // Text Vertical Alignment
-
-			if ((hAlign) || (vAlign)) { // Enter Second Point
-				To_Dxf << 11       << "\r\n"; // XYZ
-				To_Dxf << xAlign   << "\r\n"; // X in UCS (User Coordinate System)coordinates
-				To_Dxf << 21       << "\r\n";
-				To_Dxf << y        << "\r\n"; // Y in UCS (User Coordinate System)coordinates
-				To_Dxf << 31       << "\r\n";
-				To_Dxf << 0.0      << "\r\n"; // Z in UCS (User Coordinate System)coordinates
-			}
-			file.close();
 		}
 	}
+#endif
+	To_Dxf << 51        << "\r\n";
+	To_Dxf << oblique   << "\r\n";    // Text Obliqueness
+	To_Dxf << 72        << "\r\n";
+	To_Dxf << hAlign    << "\r\n";    // Text Horizontal Alignment
+	To_Dxf << 73        << "\r\n";
+	To_Dxf << vAlign    << "\r\n";    // Text Vertical Alignment
+
+	if ((hAlign) || (vAlign)) { // Enter Second Point
+		To_Dxf << 11       << "\r\n"; // XYZ
+		To_Dxf << xAlign   << "\r\n"; // X in UCS (User Coordinate System)coordinates
+		To_Dxf << 21       << "\r\n";
+		To_Dxf << y        << "\r\n"; // Y in UCS (User Coordinate System)coordinates
+		To_Dxf << 31       << "\r\n";
+		To_Dxf << 0.0      << "\r\n"; // Z in UCS (User Coordinate System)coordinates
+	}
 }
 
 /**
 	@brief Createdxf::drawPolyline
 	Convenience function for draw polyline
-	@param filepath
 	@param poly
 	@param colorcode
 	@param preScaled
 */
-void Createdxf::drawPolyline(const QString &filepath,
+void Createdxf::drawPolyline(
 	const QPolygonF &poly,
 	const int &colorcode, bool preScaled)
 {
 	qreal x,y;
-	if (!filepath.isEmpty()) {
-	QFile file(filepath);
-	if (!file.open(QFile::Append)) {
-		// error message
-		QMessageBox errorFileOpen;
-		errorFileOpen.setText("Error: File "+filepath+" was not written correctly.");
-		errorFileOpen.setInformativeText("Close all Files and Re-Run");
-		errorFileOpen.exec();
-	} else {
-		QTextStream To_Dxf(&file);
-		// Draw the Line
-		To_Dxf << 0         << "\r\n";
-		To_Dxf << "POLYLINE"    << "\r\n";
-		To_Dxf << 8         << "\r\n";
-		To_Dxf << 0         << "\r\n";    // Layer number (default layer in autocad)
-		To_Dxf << 62        << "\r\n";
-		To_Dxf << colorcode    << "\r\n";    // Colour Code
-		To_Dxf << 66        << "\r\n";
-		To_Dxf << 1         << "\r\n";
-		To_Dxf << 70        << "\r\n";
-		To_Dxf << 8         << "\r\n";
-		To_Dxf << 10        << "\r\n";
-		To_Dxf << 0         << "\r\n";
-		To_Dxf << 20         << "\r\n";
-		To_Dxf << 0         << "\r\n";
-		To_Dxf << 30        << "\r\n";
-		To_Dxf << 0        << "\r\n";
-		foreach(QPointF p, poly)
-		{
-		if(preScaled) {
-			x = p.x();
-			y = p.y();
-		} else {
-			x = p.x() * xScale;
-			y = sheetHeight - (p.y() * yScale);
-		}
-
-		To_Dxf << 0         << "\r\n";
-		To_Dxf << "VERTEX"  << "\r\n";
-		To_Dxf << 8         << "\r\n";
-		To_Dxf << 0         << "\r\n";    // Layer number (default layer in autocad)
-		To_Dxf << 70        << "\r\n";
-		To_Dxf << 32        << "\r\n";
-		To_Dxf << 10        << "\r\n";
-		To_Dxf << x         << "\r\n";    // X in UCS (User Coordinate System)coordinates
-		To_Dxf << 20        << "\r\n";
-		To_Dxf << y         << "\r\n";    // Y in UCS (User Coordinate System)coordinates
-		To_Dxf << 30        << "\r\n";
-		To_Dxf << 0.0       << "\r\n";    // Z in UCS (User Coordinate System)coordinates
-		}
-
-		To_Dxf << 0         << "\r\n";
-		To_Dxf << "SEQEND"  << "\r\n";
-		To_Dxf << 8         << "\r\n";
-		To_Dxf << 0         << "\r\n";    // Layer number (default layer in autocad)
+	if (!isOpen()) {
+		return;
+	}
 
-		file.close();
+	QTextStream &To_Dxf = m_stream;
+	// Draw the Line
+	To_Dxf << 0         << "\r\n";
+	To_Dxf << "POLYLINE"    << "\r\n";
+	To_Dxf << 8         << "\r\n";
+	To_Dxf << 0         << "\r\n";    // Layer number (default layer in autocad)
+	To_Dxf << 62        << "\r\n";
+	To_Dxf << colorcode    << "\r\n";    // Colour Code
+	To_Dxf << 66        << "\r\n";
+	To_Dxf << 1         << "\r\n";
+	To_Dxf << 70        << "\r\n";
+	To_Dxf << 8         << "\r\n";
+	To_Dxf << 10        << "\r\n";
+	To_Dxf << 0         << "\r\n";
+	To_Dxf << 20         << "\r\n";
+	To_Dxf << 0         << "\r\n";
+	To_Dxf << 30        << "\r\n";
+	To_Dxf << 0        << "\r\n";
+	foreach(QPointF p, poly)
+	{
+	if(preScaled) {
+		x = p.x();
+		y = p.y();
+	} else {
+		x = p.x() * m_x_scale;
+		y = sheetHeight - (p.y() * m_y_scale);
 	}
+
+	To_Dxf << 0         << "\r\n";
+	To_Dxf << "VERTEX"  << "\r\n";
+	To_Dxf << 8         << "\r\n";
+	To_Dxf << 0         << "\r\n";    // Layer number (default layer in autocad)
+	To_Dxf << 70        << "\r\n";
+	To_Dxf << 32        << "\r\n";
+	To_Dxf << 10        << "\r\n";
+	To_Dxf << x         << "\r\n";    // X in UCS (User Coordinate System)coordinates
+	To_Dxf << 20        << "\r\n";
+	To_Dxf << y         << "\r\n";    // Y in UCS (User Coordinate System)coordinates
+	To_Dxf << 30        << "\r\n";
+	To_Dxf << 0.0       << "\r\n";    // Z in UCS (User Coordinate System)coordinates
 	}
+
+	To_Dxf << 0         << "\r\n";
+	To_Dxf << "SEQEND"  << "\r\n";
+	To_Dxf << 8         << "\r\n";
+	To_Dxf << 0         << "\r\n";    // Layer number (default layer in autocad)
 }
 
 /* ================================================
@@ -903,88 +859,77 @@ void Createdxf::drawPolyline(const QString &filepath,
 /**
 	@brief Createdxf::drawCircle
 	draw circle in qt format
-	@param fileName
 	@param center
 	@param radius
 	@param colour
 */
 void Createdxf::drawCircle(
-		const QString& fileName,
 		QPointF center,
 		double radius,
 		int colour)
 {
-	qreal x = center.x() * xScale;
-	qreal y = sheetHeight - center.y() * yScale;
-	qreal r = radius * xScale;
-	drawCircle(fileName,r,x,y,colour);
+	qreal x = center.x() * m_x_scale;
+	qreal y = sheetHeight - center.y() * m_y_scale;
+	qreal r = radius * m_x_scale;
+	drawCircle(r,x,y,colour);
 }
 
 /**
 	@brief Createdxf::drawLine
 	Convenience function to draw line
-	@param filepath
 	@param line
 	@param colorcode
 */
 void Createdxf::drawLine(
-		const QString &filepath,
 		const QLineF &line,
 		const int &colorcode)
 {
-	drawLine(filepath, line.p1().x() * xScale,
-		 sheetHeight - (line.p1().y() * yScale),
-		 line.p2().x() * xScale,
-		 sheetHeight - (line.p2().y() * yScale),
+	drawLine(line.p1().x() * m_x_scale,
+		 sheetHeight - (line.p1().y() * m_y_scale),
+		 line.p2().x() * m_x_scale,
+		 sheetHeight - (line.p2().y() * m_y_scale),
 		 colorcode);
 }
 
 /**
 	@brief Createdxf::drawEllipse
 	Conveniance function for draw ellipse
-	@param filepath
 	@param rect
 	@param colorcode
 */
 void Createdxf::drawEllipse(
-	const QString &filepath,
 	const QRectF &rect,
 	const int &colorcode)
 {
 	drawArcEllipse(
-		filepath,
-		rect.topLeft().x() * xScale,
-		sheetHeight - (rect.topLeft().y() * yScale),
-		rect.width() * xScale,
-		rect.height() * yScale,
+		rect.topLeft().x() * m_x_scale,
+		sheetHeight - (rect.topLeft().y() * m_y_scale),
+		rect.width() * m_x_scale,
+		rect.height() * m_y_scale,
 		0, 360, 0, 0, 0, colorcode);
 }
 
 /**
 	@brief Createdxf::drawRectangle
 	Convenience function for draw rectangle
-	@param filepath
 	@param rect
 	@param colorcode
 */
 void Createdxf::drawRectangle(
-	const QString &filepath,
 	const QRectF &rect,
 	const int &colorcode) {
 	//QPolygonF poly(scaleRect(rect));
 	QPolygonF poly(rect);
-	drawPolyline(filepath,poly,colorcode);
+	drawPolyline(poly,colorcode);
 }
 
 /**
 	@brief Createdxf::drawPolygon
 	Convenience function for draw polygon
-	@param filepath
 	@param poly
 	@param colorcode
 */
 void Createdxf::drawPolygon(
-	const QString &filepath,
 	const QPolygonF &poly,
 	const int &colorcode)
 {
@@ -992,13 +937,12 @@ void Createdxf::drawPolygon(
 	if(!poly.isClosed()) {
 	pg << poly.at(0); // Close it
 	}
-	drawPolyline(filepath,pg,colorcode);
+	drawPolyline(pg,colorcode);
 }
 
 /**
 	@brief Createdxf::drawText
 	draw simple text in dxf format without any alignment specified
-	@param fileName
 	@param text
 	@param point
 	@param height
@@ -1007,7 +951,6 @@ void Createdxf::drawPolygon(
 	@param xScaleW = 1
 */
 void Createdxf::drawText(
-	const QString& fileName,
 	const QString& text,
 	QPointF point,
 	double height,
@@ -1015,12 +958,11 @@ void Createdxf::drawText(
 	int colour,
 	double xScaleW)
 {
-	qreal x = point.x() * xScale;
-	qreal y = sheetHeight - (point.y() * yScale);
-	drawText(fileName,text,x,y,height * yScale,rotation,colour,xScaleW);
+	qreal x = point.x() * m_x_scale;
+	qreal y = sheetHeight - (point.y() * m_y_scale);
+	drawText(text,x,y,height * m_y_scale,rotation,colour,xScaleW);
 }
 void Createdxf::drawArcEllipse(
-	const QString &file_path,
 	QRectF rect,
 	qreal startAngle,
 	qreal spanAngle,
@@ -1028,13 +970,242 @@ void Createdxf::drawArcEllipse(
 	qreal rotation_angle,
 	const int &colorcode)
 {
-	qreal x = rect.x() * xScale;
-	qreal y = sheetHeight - rect.y() * yScale;
-	qreal w = rect.width() * xScale;
-	qreal h = rect.height() * yScale;
-	qreal hotspot_x = hotspot.x() * xScale;
-	qreal hotspot_y = sheetHeight - hotspot.y() * yScale;
-	drawArcEllipse(file_path,x,y,w,h,startAngle,spanAngle,hotspot_x,hotspot_y,rotation_angle,colorcode);
+	qreal x = rect.x() * m_x_scale;
+	qreal y = sheetHeight - rect.y() * m_y_scale;
+	qreal w = rect.width() * m_x_scale;
+	qreal h = rect.height() * m_y_scale;
+	qreal hotspot_x = hotspot.x() * m_x_scale;
+	qreal hotspot_y = sheetHeight - hotspot.y() * m_y_scale;
+	drawArcEllipse(x,y,w,h,startAngle,spanAngle,hotspot_x,hotspot_y,rotation_angle,colorcode);
+}
+
+/* ================================================
+ * The functions below open the file given in parameter,
+ * append one primitive and close the file.
+ * To write a complete export, use a Createdxf object.
+ * ================================================
+ */
+/**
+	@brief Createdxf::dxfBegin
+	Truncate the file and write the header section of a DXF file
+	@param file_path
+	@return true if the file was written
+*/
+bool Createdxf::dxfBegin(const QString &file_path)
+{
+	Createdxf dxf(file_path, 1.0, 1.0);
+	dxf.dxfBegin();
+	return dxf.close();
+}
+
+/**
+	@brief Createdxf::dxfEnd
+	Append the end section of a DXF file
+	@param file_path
+	@return true if the file was written
+*/
+bool Createdxf::dxfEnd(const QString &file_path)
+{
+	Createdxf dxf(file_path, 1.0, 1.0, QFile::Append);
+	dxf.dxfEnd();
+	return dxf.close();
+}
+
+bool Createdxf::drawCircle(
+		const QString &file_path,
+		double radius,
+		double x,
+		double y,
+		int colour)
+{
+	Createdxf dxf(file_path, 1.0, 1.0, QFile::Append);
+	dxf.drawCircle(radius, x, y, colour);
+	return dxf.close();
+}
+
+bool Createdxf::drawCircle(
+		const QString &file_path,
+		QPointF center,
+		double radius,
+		int colour)
+{
+	Createdxf dxf(file_path, 1.0, 1.0, QFile::Append);
+	dxf.drawCircle(center, radius, colour);
+	return dxf.close();
+}
+
+bool Createdxf::drawArc(
+		const QString &file_path,
+		double x,
+		double y,
+		double rad,
+		double startAngle,
+		double endAngle,
+		int color)
+{
+	Createdxf dxf(file_path, 1.0, 1.0, QFile::Append);
+	dxf.drawArc(x, y, rad, startAngle, endAngle, color);
+	return dxf.close();
+}
+
+bool Createdxf::drawArcEllipse(
+		const QString &file_path,
+		qreal x,
+		qreal y,
+		qreal w,
+		qreal h,
+		qreal startAngle,
+		qreal spanAngle,
+		qreal hotspot_x,
+		qreal hotspot_y,
+		qreal rotation_angle,
+		const int &colorcode)
+{
+	Createdxf dxf(file_path, 1.0, 1.0, QFile::Append);
+	dxf.drawArcEllipse(x, y, w, h, startAngle, spanAngle,
+			   hotspot_x, hotspot_y, rotation_angle, colorcode);
+	return dxf.close();
+}
+
+bool Createdxf::drawArcEllipse(
+		const QString &file_path,
+		QRectF rect,
+		qreal startAngle,
+		qreal spanAngle,
+		QPointF hotspot,
+		qreal rotation_angle,
+		const int &colorcode)
+{
+	Createdxf dxf(file_path, 1.0, 1.0, QFile::Append);
+	dxf.drawArcEllipse(rect, startAngle, spanAngle,
+			   hotspot, rotation_angle, colorcode);
+	return dxf.close();
+}
+
+bool Createdxf::drawEllipse(
+		const QString &file_path,
+		const QRectF &rect,
+		const int &colorcode)
+{
+	Createdxf dxf(file_path, 1.0, 1.0, QFile::Append);
+	dxf.drawEllipse(rect, colorcode);
+	return dxf.close();
+}
+
+bool Createdxf::drawRectangle(
+		const QString &file_path,
+		double x1,
+		double y1,
+		double width,
+		double height,
+		const int &colour)
+{
+	Createdxf dxf(file_path, 1.0, 1.0, QFile::Append);
+	dxf.drawRectangle(x1, y1, width, height, colour);
+	return dxf.close();
+}
+
+bool Createdxf::drawRectangle(
+		const QString &file_path,
+		const QRectF &rect,
+		const int &colorcode)
+{
+	Createdxf dxf(file_path, 1.0, 1.0, QFile::Append);
+	dxf.drawRectangle(rect, colorcode);
+	return dxf.close();
+}
+
+bool Createdxf::drawPolygon(
+		const QString &file_path,
+		const QPolygonF &poly,
+		const int &colorcode)
+{
+	Createdxf dxf(file_path, 1.0, 1.0, QFile::Append);
+	dxf.drawPolygon(poly, colorcode);
+	return dxf.close();
+}
+
+bool Createdxf::drawLine(
+		const QString &file_path,
+		double x1,
+		double y1,
+		double x2,
+		double y2,
+		const int &colour)
+{
+	Createdxf dxf(file_path, 1.0, 1.0, QFile::Append);
+	dxf.drawLine(x1, y1, x2, y2, colour);
+	return dxf.close();
+}
+
+bool Createdxf::drawLine(
+		const QString &file_path,
+		const QLineF &line,
+		const int &colorcode)
+{
+	Createdxf dxf(file_path, 1.0, 1.0, QFile::Append);
+	dxf.drawLine(line, colorcode);
+	return dxf.close();
+}
+
+bool Createdxf::drawText(
+		const QString &file_path,
+		const QString &text,
+		double x,
+		double y,
+		double height,
+		double rotation,
+		int colour,
+		double xScaleW)
+{
+	Createdxf dxf(file_path, 1.0, 1.0, QFile::Append);
+	dxf.drawText(text, x, y, height, rotation, colour, xScaleW);
+	return dxf.close();
+}
+
+bool Createdxf::drawText(
+		const QString &file_path,
+		const QString &text,
+		QPointF point,
+		double height,
+		double rotation,
+		int colour,
+		double xScaleW)
+{
+	Createdxf dxf(file_path, 1.0, 1.0, QFile::Append);
+	dxf.drawText(text, point, height, rotation, colour, xScaleW);
+	return dxf.close();
+}
+
+bool Createdxf::drawTextAligned(
+		const QString &file_path,
+		const QString &text,
+		double x,
+		double y,
+		double height,
+		double rotation,
+		double oblique,
+		int hAlign,
+		int vAlign,
+		double xAlign,
+		double xScaleW,
+		int colour)
+{
+	Createdxf dxf(file_path, 1.0, 1.0, QFile::Append);
+	dxf.drawTextAligned(text, x, y, height, rotation, oblique,
+			    hAlign, vAlign, xAlign, xScaleW, colour);
+	return dxf.close();
+}
+
+bool Createdxf::drawPolyline(
+		const QString &file_path,
+		const QPolygonF &poly,
+		const int &colorcode,
+		bool preScaled)
+{
+	Createdxf dxf(file_path, 1.0, 1.0, QFile::Append);
+	dxf.drawPolyline(poly, colorcode, preScaled);
+	return dxf.close();
 }
 
 /*
@@ -23,30 +23,124 @@
 
 /**
 	@brief The Createdxf class
-	This class exports the project to DXF Format
+	This class exports the project to DXF Format.
+	A Createdxf object is a writer open on a file, all the primitives
+	drawn with it are written through one buffered stream,
+	with the scale factors given to its constructor.
+	The static functions with a file path open the file for each call,
+	with a scale of 1, they return false if the file can't be written.
 */
 class Createdxf
 {
 	public:
-		Createdxf();
+		Createdxf(const QString &file_path,
+			  double x_scale,
+			  double y_scale,
+			  QIODevice::OpenMode mode = QIODevice::WriteOnly
+						     | QIODevice::Truncate);
 		~Createdxf();
-		static void dxfBegin (const QString&);
-		static void dxfEnd(const QString&);
+		Createdxf(const Createdxf &) = delete;
+		Createdxf &operator=(const Createdxf &) = delete;
+
+		bool isOpen() const;
+		bool close();
+		double xScale() const {return m_x_scale;}
+		double yScale() const {return m_y_scale;}
+
+		void dxfBegin();
+		void dxfEnd();
 		// you can add more functions to create more drawings.
-		static void drawCircle(
+		void drawCircle(double radius, double x, double y, int colour);
+		void drawCircle(QPointF center, double radius, int colour);
+		void drawArc(
+				double x,
+				double y,
+				double rad,
+				double startAngle,
+				double endAngle,
+				int color);
+		void drawArcEllipse(
+				qreal x,
+				qreal y,
+				qreal w,
+				qreal h,
+				qreal startAngle,
+				qreal spanAngle,
+				qreal hotspot_x,
+				qreal hotspot_y,
+				qreal rotation_angle,
+				const int &colorcode);
+		void drawArcEllipse(
+				QRectF rect,
+				qreal startAngle,
+				qreal spanAngle,
+				QPointF hotspot,
+				qreal rotation_angle,
+				const int &colorcode);
+		void drawEllipse(const QRectF &rect, const int &colorcode);
+		void drawRectangle(
+				double x1,
+				double y1,
+				double width,
+				double height,
+				const int &colorcode);
+		void drawRectangle(const QRectF &rect, const int &colorcode);
+		void drawPolygon(const QPolygonF &poly, const int &colorcode);
+		void drawLine(
+				double x1,
+				double y1,
+				double x2,
+				double y2,
+				const int &colorcode);
+		void drawLine(const QLineF &line, const int &colorcode);
+		void drawText(
+				const QString &text,
+				double x,
+				double y,
+				double height,
+				double rotation,
+				int colour,
+				double xScaleW=1.0);
+		void drawText(
+				const QString &text,
+				QPointF point,
+				double height,
+				double rotation,
+				int colour,
+				double xScaleW=1.0);
+		void drawTextAligned(
+				const QString &text,
+				double x,
+				double y,
+				double height,
+				double rotation,
+				double oblique,
+				int hAlign,
+				int vAlign,
+				double xAlign,
+				double xScaleW,
+				int colour);
+		void drawPolyline(
+				const QPolygonF &poly,
+				const int &colorcode,
+				bool preScaled = false);
+
+		static bool dxfBegin (const QString&);
+		static bool dxfEnd(const QString&);
+		static bool drawCircle(
 				const QString&,
 				double,
 				double,
 				double,
 				int);
 
-		static void drawCircle(
+		static bool drawCircle(
 				const QString& ,
 				QPointF,
 				double,
 				int );
 
-		static void drawArc(
+		static bool drawArc(
 				const QString&,
 				double x,
 				double y,
@@ -54,9 +148,8 @@ class Createdxf
 				double startAngle,
 				double endAngle,
 				int color);
-		static void drawDonut(QString,double,double,double,int);
 
-		static void drawArcEllipse (
+		static bool drawArcEllipse (
 				const QString &file_path,
 				qreal x,
 				qreal y,
@@ -69,7 +162,7 @@ class Createdxf
 				qreal rotation_angle,
 				const int &colorcode);
 
-	static void drawArcEllipse(
+	static bool drawArcEllipse(
 		const QString &file_path,
 		QRectF rect,
 		qreal startAngle,
@@ -78,56 +171,56 @@ class Createdxf
 		qreal rotation_angle,
 		const int &colorcode);
 
-		static void drawEllipse (const QString &filepath,
+		static bool drawEllipse (const QString &filepath,
 					 const QRectF &rect,
 					 const int &colorcode);
 
-		static void drawRectangle(
+		static bool drawRectangle(
 				const QString &filepath,
 				double,
 				double,
 				double,
 				double,
 				const int &colorcode);
-		static void drawRectangle(
+		static bool drawRectangle(
 				const QString &filepath,
 				const QRectF &rect,
 				const int &colorcode);
 
-		static void drawPolygon(
+		static bool drawPolygon(
 				const QString &filepath,
 				const QPolygonF &poly,
 				const int &colorcode);
 
-		static void drawLine(
+		static bool drawLine(
 				const QString &filapath,
 				double,
 				double,
 				double,
 				double,
 				const int &clorcode);
-		static void drawLine(
+		static bool drawLine(
 				const QString &filepath,
 				const QLineF &line,
 				const int &colorcode);
 
-		static void drawText(
+		static bool drawText(
 				const QString&,
 				const QString&,
 				double,double,
 				double,
 				double,
 		int,
-		double xScale=1.0);
-	static void drawText(
+		double xScaleW=1.0);
+	static bool drawText(
 		const QString&,
 		const QString&,
 		QPointF,
 		double,
 		double,
 		int,
-		double xScale=1.0);
-		static void drawTextAligned(
+		double xScaleW=1.0);
+		static bool drawTextAligned(
 				const QString& fileName,
 				const QString& text,
 				double x,
@@ -138,10 +231,10 @@ class Createdxf
 				int hAlign,
 				int vAlign,
 				double xAlign,
-				double xScale,
+				double xScaleW,
 				int colour);
 
-	static void drawPolyline(
+	static bool drawPolyline(
 		const QString &filepath,
 		const QPolygonF &poly,
 		const int &colorcode,
@@ -157,8 +250,12 @@ class Createdxf
 
 		static const double sheetWidth;
 		static const double sheetHeight;
-		static double		xScale;
-		static double		yScale;
+
+	private:
+		QFile m_file;
+		QTextStream m_stream;
+		double m_x_scale;
+		double m_y_scale;
 };
 
 #endif // CREATEDXF_H
@@ -27,6 +27,7 @@
 
 #include <QLocale>
 #include <QSqlError>
+#include <QTimer>
 
 #include <QSqlDriver>
 #include <sqlite3.h>
@@ -63,7 +64,7 @@ projectDataBase::projectDataBase(QETProject *project, QObject *parent) :
 			m_diagram_info_order_changed.exec();
 
 		}
-		emit dataBaseUpdated();
+		notifyUpdated();
 	});
 }
 
@@ -79,15 +80,132 @@ projectDataBase::~projectDataBase()
 /**
 	@brief projectDataBase::updateDB
 	Up to date the content of the data base.
+	All tables are rewritten in one transaction.
 	Emit the signal dataBaseUpdated
 */
 void projectDataBase::updateDB()
 {
+		//Everything is rewritten, the pending changes are useless.
+	m_dirty_elements.clear();
+	m_removed_elements.clear();
+	m_dirty_diagrams.clear();
+
+	m_data_base.transaction();
 	populateDiagramTable();
 	populateDiagramInfoTable();
 	populateElementTable();
 	populateElementInfoTable();
-	emit dataBaseUpdated();
+	m_data_base.commit();
+	notifyUpdated();
+}
+
+/**
+	@brief projectDataBase::updatePendingChanges
+	Write in the database the elements and diagrams
+	marked as changed by addElement, removeElement,
+	elementInfoChanged and diagramInfoChanged, in one transaction.
+	This is done automatically at the next turn of the event loop
+	after a change, but can be called to write the changes immediately.
+	Emit the signal dataBaseUpdated once if something was written.
+*/
+void projectDataBase::updatePendingChanges()
+{
+	m_pending_scheduled = false;
+	if (writePendingChanges()) {
+		notifyUpdated();
+	}
+}
+
+/**
+	@brief projectDataBase::flushPendingChanges
+	Write the pending changes before a query, like updatePendingChanges,
+	but the signal dataBaseUpdated is emitted at the next turn
+	of the event loop : the queries are made by the slots connected
+	to this signal, which must not be called again from inside the query.
+*/
+void projectDataBase::flushPendingChanges()
+{
+	if (!writePendingChanges()) {
+		return;
+	}
+
+	++m_generation;
+	m_query_cache.clear();
+	if (m_notify_scheduled) {
+		return;
+	}
+	m_notify_scheduled = true;
+	QTimer::singleShot(0, this, [this]()
+	{
+		m_notify_scheduled = false;
+		emit dataBaseUpdated();
+	});
+}
+
+/**
+	@brief projectDataBase::writePendingChanges
+	Write the pending changes in the database, in one transaction.
+	@return true if something was written
+*/
+bool projectDataBase::writePendingChanges()
+{
+	if (m_dirty_elements.isEmpty()
+		&& m_removed_elements.isEmpty()
+		&& m_dirty_diagrams.isEmpty()) {
+		return false;
+	}
+
+		//Same types as the full update (see populateElementTable)
+	const ElementData::Types types = ElementData::Simple
+					 | ElementData::Terminale
+					 | ElementData::Master
+					 | ElementData::Thumbnail;
+	QVector<QVariantList> element_rows, element_info_rows;
+	for (const auto &elmt : qAsConst(m_dirty_elements))
+	{
+		if (elmt
+			&& elmt->diagram()
+			&& (types & elmt->elementData().m_type))
+		{
+			element_rows << elementValues(elmt);
+			element_info_rows << elementInfoValues(elmt);
+		}
+	}
+
+	QVector<QVariantList> diagram_info_rows;
+	for (const auto &diagram : qAsConst(m_dirty_diagrams))
+	{
+		if (diagram) {
+			diagram_info_rows << diagramInfoValues(diagram);
+		}
+	}
+
+	m_data_base.transaction();
+	for (const auto &uuid : qAsConst(m_removed_elements))
+	{
+		m_remove_element_query.bindValue(":uuid", uuid);
+		if(!m_remove_element_query.exec()) {
+			qDebug() << "projectDataBase::writePendingChanges remove error : " << m_remove_element_query.lastError();
+		}
+	}
+	insertRows(QStringLiteral("REPLACE INTO element (uuid, diagram_uuid, pos, type, sub_type) VALUES "),
+		   5, element_rows);
+	insertRows(QStringLiteral("REPLACE INTO element_info (element_uuid, ")
+		   + QETInformation::elementInfoKeys().join(", ")
+		   + QStringLiteral(") VALUES "),
+		   QETInformation::elementInfoKeys().size() + 1,
+		   element_info_rows);
+	insertRows(QStringLiteral("REPLACE INTO diagram_info (diagram_uuid, ")
+		   + QETInformation::diagramInfoKeys().join(", ")
+		   + QStringLiteral(") VALUES "),
+		   QETInformation::diagramInfoKeys().size() + 1,
+		   diagram_info_rows);
+	m_data_base.commit();
+
+	m_dirty_elements.clear();
+	m_removed_elements.clear();
+	m_dirty_diagrams.clear();
+	return true;
 }
 
 /**
@@ -101,90 +219,106 @@ QETProject *projectDataBase::project() const
 
 /**
 	@brief projectDataBase::newQuery
+	The pending changes are written before the query is created.
 	@return a QSqlquery with query as query
 	and the internal database of this class as database to use.
 */
 QSqlQuery projectDataBase::newQuery(const QString &query) {
+	flushPendingChanges();
 	return QSqlQuery(query, m_data_base);
 }
 
 /**
-	@brief projectDataBase::addElement
-	@param element
+	@brief projectDataBase::queryRecords
+	Execute query and return the value of each column of each row,
+	the dates are converted to string with the short format of the system locale.
+	The result is cached by query string until the content of the database change,
+	so several tables with the same query execute it only once.
+	@param query
+	@return the records returned by query
 */
-void projectDataBase::addElement(Element *element)
+QVector<QStringList> projectDataBase::queryRecords(const QString &query)
 {
-	m_insert_elements_query.bindValue(":uuid", element->uuid().toString());
-	m_insert_elements_query.bindValue(":diagram_uuid", element->diagram()->uuid().toString());
-	m_insert_elements_query.bindValue(":pos", element->diagram()->convertPosition(element->scenePos()).toString());
-	m_insert_elements_query.bindValue(":type", element->elementData().typeToString());
-	m_insert_elements_query.bindValue(":sub_type", element->kindInformations()["type"].toString());
-	if (!m_insert_elements_query.exec()) {
-		qDebug() << "projectDataBase::addElement insert element error : " << m_insert_elements_query.lastError();
+	flushPendingChanges();
+
+	auto it = m_query_cache.constFind(query);
+	if (it != m_query_cache.constEnd()) {
+		return it.value();
 	}
 
-	m_insert_element_info_query.bindValue(":uuid", element->uuid().toString());
-	auto hash = elementInfoToString(element);
-	for (auto key : hash.keys())
-	{
-		QString value = hash.value(key);
-		QString bind = key.prepend(":");
-		m_insert_element_info_query.bindValue(bind, value);
+	QVector<QStringList> records;
+	QSqlQuery query_(query, m_data_base);
+	if (!query_.exec()) {
+		qDebug() << "Query error : " << query_.lastError();
 	}
 
-	if (!m_insert_element_info_query.exec()) {
-		qDebug() << "projectDataBase::addElement insert element info error : " << m_insert_element_info_query.lastError();
-	} else {
-		emit dataBaseUpdated();
+	while (query_.next())
+	{
+		QStringList record_;
+		auto i=0;
+		while (query_.value(i).isValid())
+		{
+			auto date = query_.value(i).toDate();
+			if (!date.isNull()) {
+				record_ << QLocale::system().toString(date, QLocale::ShortFormat);
+			} else {
+				record_ << query_.value(i).toString();
+			}
+			++i;
+		}
+		records << record_;
 	}
+
+	m_query_cache.insert(query, records);
+	return records;
+}
+
+/**
+	@brief projectDataBase::addElement
+	Mark element as added, the database is updated
+	at the next turn of the event loop.
+	@param element
+*/
+void projectDataBase::addElement(Element *element)
+{
+	const auto uuid = element->uuid().toString();
+	m_removed_elements.remove(uuid);
+	m_dirty_elements.insert(uuid, element);
+	schedulePendingChanges();
 }
 
 /**
 	@brief projectDataBase::removeElement
+	Mark element as removed, the database is updated
+	at the next turn of the event loop.
 	@param element
 */
 void projectDataBase::removeElement(Element *element)
 {
-	m_remove_element_query.bindValue(":uuid", element->uuid().toString());
-	if(!m_remove_element_query.exec()) {
-		qDebug() << "projectDataBase::removeElement remove error : " << m_remove_element_query.lastError();
-	} else {
-		emit dataBaseUpdated();
-	}
+	const auto uuid = element->uuid().toString();
+	m_dirty_elements.remove(uuid);
+	m_removed_elements.insert(uuid);
+	schedulePendingChanges();
 }
 
 /**
 	@brief projectDataBase::elementInfoChanged
+	Mark the information of element as changed, the database is updated
+	at the next turn of the event loop.
 	@param element
 */
 void projectDataBase::elementInfoChanged(Element *element)
 {
-	auto hash = elementInfoToString(element);
-	for (auto str : QETInformation::elementInfoKeys()) {
-		m_update_element_query.bindValue(":" + str, hash.value(str));
-	}
-	m_update_element_query.bindValue(":uuid", element->uuid().toString());
-	if (!m_update_element_query.exec()) {
-		qDebug() << "projectDataBase::elementInfoChanged update error : " << m_update_element_query.lastError();
-	} else {
-		emit dataBaseUpdated();
-	}
+	m_dirty_elements.insert(element->uuid().toString(), element);
+	schedulePendingChanges();
 }
 
 void projectDataBase::elementInfoChanged(QList<Element *> elements)
 {
-	this->blockSignals(true);
-		//Block signal for not emit dataBaseUpdated at
-		//each call of the method elementInfoChanged(Element *element)
-
-	m_data_base.transaction();	
 	for (auto elmt : elements) {
-		elementInfoChanged(elmt);
+		m_dirty_elements.insert(elmt->uuid().toString(), elmt);
 	}
-	m_data_base.commit();
-
-	this->blockSignals(false);
-	emit dataBaseUpdated();
+	schedulePendingChanges();
 }
 
 void projectDataBase::addDiagram(Diagram *diagram)
@@ -212,7 +346,7 @@ void projectDataBase::addDiagram(Diagram *diagram)
 			qDebug() << "projectDataBase::addDiagram update diagram infp order error : " << m_diagram_info_order_changed.lastError();
 		}
 	}
-	emit dataBaseUpdated();
+	notifyUpdated();
 }
 
 void projectDataBase::removeDiagram(Diagram *diagram)
@@ -221,25 +355,32 @@ void projectDataBase::removeDiagram(Diagram *diagram)
 	if (!m_remove_diagram_query.exec()) {
 		qDebug() << "projectDataBase::removeDiagram delete error : " << m_remove_diagram_query.lastError();
 	} else {
-		emit dataBaseUpdated();
+		notifyUpdated();
 	}
 }
 
 void projectDataBase::diagramInfoChanged(Diagram *diagram)
 {
-	bindDiagramInfoValues(m_update_diagram_info_query, diagram);
-
-	if (!m_update_diagram_info_query.exec()) {
-		qDebug() << "projectDataBase::diagramInfoChanged update error : " << m_update_diagram_info_query.lastError();
-	} else {
-		emit dataBaseUpdated();
-	}
+	m_dirty_diagrams.insert(diagram->uuid().toString(), diagram);
+	schedulePendingChanges();
 }
 
 void projectDataBase::diagramOrderChanged()
 {
 }
 
+/**
+	@brief projectDataBase::notifyUpdated
+	Start a new generation of the database content,
+	drop the cached query results and emit the signal dataBaseUpdated
+*/
+void projectDataBase::notifyUpdated()
+{
+	++m_generation;
+	m_query_cache.clear();
+	emit dataBaseUpdated();
+}
+
 /**
 	@brief projectDataBase::createDataBase
 	Create the data base
@@ -428,14 +569,11 @@ void projectDataBase::populateDiagramTable()
 	QSqlQuery query_(m_data_base);
 	query_.exec("DELETE FROM diagram");
 
-	for (auto diagram : m_project->diagrams())
-	{
-		m_insert_diagram_query.bindValue(":uuid", diagram->uuid().toString());
-		m_insert_diagram_query.bindValue(":pos", m_project->folioIndex(diagram)+1);
-		if(!m_insert_diagram_query.exec()) {
-			qDebug() << "projectDataBase::populateDiagramTable insert error : " << m_insert_diagram_query.lastError();
-		}
+	QVector<QVariantList> rows;
+	for (auto diagram : m_project->diagrams()) {
+		rows << diagramValues(diagram);
 	}
+	insertRows(QStringLiteral("INSERT INTO diagram (uuid, pos) VALUES "), 2, rows);
 }
 
 /**
@@ -447,24 +585,18 @@ void projectDataBase::populateElementTable()
 	QSqlQuery query_(m_data_base);
 	query_.exec("DELETE FROM element");
 
+	QVector<QVariantList> rows;
 	for (auto diagram : m_project->diagrams())
 	{
 		const ElementProvider ep(diagram);
 		const auto elmt_vector = ep.find(ElementData::Simple | ElementData::Terminale | ElementData::Master | ElementData::Thumbnail);
-			//Insert all value into the database
-		for (const auto &elmt : elmt_vector)
-		{
-			const auto elmt_data = elmt->elementData();
-			m_insert_elements_query.bindValue(":uuid", elmt->uuid().toString());
-			m_insert_elements_query.bindValue(":diagram_uuid", diagram->uuid().toString());
-			m_insert_elements_query.bindValue(":pos", diagram->convertPosition(elmt->scenePos()).toString());
-			m_insert_elements_query.bindValue(":type", elmt_data.typeToString());
-			m_insert_elements_query.bindValue(":sub_type", elmt_data.masterTypeToString());
-			if (!m_insert_elements_query.exec()) {
-				qDebug() << "projectDataBase::populateElementTable insert error : " << m_insert_elements_query.lastError();
-			}
+		for (const auto &elmt : elmt_vector) {
+			rows << elementValues(elmt);
 		}
 	}
+		//Insert all value into the database
+	insertRows(QStringLiteral("INSERT INTO element (uuid, diagram_uuid, pos, type, sub_type) VALUES "),
+		   5, rows);
 }
 
 /**
@@ -476,28 +608,21 @@ void projectDataBase::populateElementInfoTable()
 	QSqlQuery query(m_data_base);
 	query.exec(QStringLiteral("DELETE FROM element_info"));
 
+	QVector<QVariantList> rows;
 	for (const auto &diagram : m_project->diagrams())
 	{
 		const ElementProvider ep(diagram);
 		const auto elmt_vector = ep.find(ElementData::Simple | ElementData::Terminale | ElementData::Master | ElementData::Thumbnail);
-
-			//Insert all value into the database
-		for (const auto &elmt : elmt_vector)
-		{
-			m_insert_element_info_query.bindValue(QStringLiteral(":uuid"), elmt->uuid().toString());
-			const auto hash = elementInfoToString(elmt);
-			for (const auto &key : hash.keys())
-			{
-				QString value = hash.value(key);
-				QString bind = QStringLiteral(":") + key;
-				m_insert_element_info_query.bindValue(bind, value);
-			}
-
-			if (!m_insert_element_info_query.exec()) {
-				qDebug() << "projectDataBase::populateElementInfoTable insert error : " << m_insert_element_info_query.lastError();
-			}
+		for (const auto &elmt : elmt_vector) {
+			rows << elementInfoValues(elmt);
 		}
 	}
+		//Insert all value into the database
+	insertRows(QStringLiteral("INSERT INTO element_info (element_uuid, ")
+		   + QETInformation::elementInfoKeys().join(", ")
+		   + QStringLiteral(") VALUES "),
+		   QETInformation::elementInfoKeys().size() + 1,
+		   rows);
 }
 
 void projectDataBase::populateDiagramInfoTable()
@@ -505,14 +630,83 @@ void projectDataBase::populateDiagramInfoTable()
 	QSqlQuery query(m_data_base);
 	query.exec("DELETE FROM diagram_info");
 
-	for (auto *diagram : m_project->diagrams())
+	QVector<QVariantList> rows;
+	for (auto *diagram : m_project->diagrams()) {
+		rows << diagramInfoValues(diagram);
+	}
+	insertRows(QStringLiteral("INSERT INTO diagram_info (diagram_uuid, ")
+		   + QETInformation::diagramInfoKeys().join(", ")
+		   + QStringLiteral(") VALUES "),
+		   QETInformation::diagramInfoKeys().size() + 1,
+		   rows);
+}
+
+/**
+	@brief projectDataBase::schedulePendingChanges
+	Call updatePendingChanges at the next turn of the event loop,
+	several changes made in a row are written together.
+*/
+void projectDataBase::schedulePendingChanges()
+{
+	if (m_pending_scheduled) {
+		return;
+	}
+	m_pending_scheduled = true;
+	QTimer::singleShot(0, this, &projectDataBase::updatePendingChanges);
+}
+
+/**
+	@brief projectDataBase::insertRows
+	Insert rows with multi-row statements.
+	@param statement : the beginning of the statement, without the values
+	for example "INSERT INTO diagram (uuid, pos) VALUES "
+	@param columns_count : the number of columns of each row
+	@param rows : the values of each row, in the order of the columns
+	@return true if all rows are inserted
+*/
+bool projectDataBase::insertRows(const QString &statement,
+				 int columns_count,
+				 const QVector<QVariantList> &rows)
+{
+	if (rows.isEmpty() || columns_count < 1) {
+		return true;
+	}
+
+		//SQLite limit the number of parameters of a statement to 999
+	const int max_rows = qMax(1, 999 / columns_count);
+	const QString row_str = QStringLiteral("(?")
+				+ QStringLiteral(", ?").repeated(columns_count - 1)
+				+ QStringLiteral(")");
+
+	bool success = true;
+	QSqlQuery query(m_data_base);
+	int prepared_rows = 0;
+	for (int first = 0 ; first < rows.size() ; first += max_rows)
 	{
-		bindDiagramInfoValues(m_insert_diagram_info_query, diagram);
+		const int count = qMin(max_rows, rows.size() - first);
+		if (count != prepared_rows)
+		{
+			QStringList values;
+			for (int i = 0 ; i < count ; ++i) {
+				values << row_str;
+			}
+			query.prepare(statement + values.join(", "));
+			prepared_rows = count;
+		}
 
-		if (!m_insert_diagram_info_query.exec()) {
-			qDebug() << "projectDataBase::populateDiagramInfoTable insert error : " << m_insert_diagram_info_query.lastError();
+		for (int i = first ; i < first + count ; ++i) {
+			for (const auto &value : rows.at(i)) {
+				query.addBindValue(value);
+			}
+		}
+
+		if (!query.exec())
+		{
+			qDebug() << "projectDataBase::insertRows error : " << query.lastError();
+			success = false;
 		}
 	}
+	return success;
 }
 
 void projectDataBase::prepareQuery()
@@ -538,95 +732,99 @@ void projectDataBase::prepareQuery()
 				   ")");
 	m_insert_diagram_info_query.prepare(insert_diag_info);
 
-		//UPDATE DIAGRAM INFO
-	QString update_diagram_str("UPDATE diagram_info SET ");
-	for (auto str : QETInformation::diagramInfoKeys()) {
-		update_diagram_str.append(str + " = :" + str + ", ");
-	}
-	update_diagram_str.remove(update_diagram_str.length()-2, 2); //Remove the last ", "
-	update_diagram_str.append(" WHERE diagram_uuid = :uuid");
-	m_update_diagram_info_query = QSqlQuery(m_data_base);
-	m_update_diagram_info_query.prepare(update_diagram_str);
-
 		//UPDATE DIAGRAM ORDER
 	m_diagram_order_changed = QSqlQuery(m_data_base);
 	m_diagram_order_changed.prepare("UPDATE diagram SET pos = :pos WHERE uuid = :uuid");
 	m_diagram_info_order_changed = QSqlQuery(m_data_base);
 	m_diagram_info_order_changed.prepare("UPDATE diagram_info SET folio = :folio WHERE diagram_uuid = :uuid");
 
-		//INSERT ELEMENT
-	QString insert_element_query("INSERT INTO element (uuid, diagram_uuid, pos, type, sub_type) VALUES (:uuid, :diagram_uuid, :pos, :type, :sub_type)");
-	m_insert_elements_query = QSqlQuery(m_data_base);
-	m_insert_elements_query.prepare(insert_element_query);
-
-
-		//INSERT ELEMENT INFO
-	QStringList bind_values;
-	for (auto key : QETInformation::elementInfoKeys()) {
-		bind_values << key.prepend(":");
-	}
-	QString insert_element_info("INSERT INTO element_info (element_uuid," +
-				   QETInformation::elementInfoKeys().join(", ") +
-				   ") VALUES (:uuid," +
-				   bind_values.join(", ") +
-				   ")");
-	m_insert_element_info_query = QSqlQuery(m_data_base);
-	m_insert_element_info_query.prepare(insert_element_info);
-
 		//REMOVE ELEMENT
 	QString remove_element("DELETE FROM element WHERE uuid=:uuid");
 	m_remove_element_query = QSqlQuery(m_data_base);
 	m_remove_element_query.prepare(remove_element);
+}
 
-		//UPDATE ELEMENT INFO
-	QString update_str("UPDATE element_info SET ");
-	for (auto string : QETInformation::elementInfoKeys()) {
-		update_str.append(string + " = :" + string + ", ");
-	}
-	update_str.remove(update_str.length()-2, 2); //Remove the last ", "
-	update_str.append(" WHERE element_uuid = :uuid");
-	m_update_element_query = QSqlQuery(m_data_base);
-	m_update_element_query.prepare(update_str);
+/**
+	@brief projectDataBase::elementValues
+	@param elmt
+	@return the values of a row of the element table for elmt,
+	in the order : uuid, diagram_uuid, pos, type, sub_type
+*/
+QVariantList projectDataBase::elementValues(Element *elmt)
+{
+	const auto elmt_data = elmt->elementData();
+	return QVariantList {elmt->uuid().toString(),
+				elmt->diagram()->uuid().toString(),
+				elmt->diagram()->convertPosition(elmt->scenePos()).toString(),
+				elmt_data.typeToString(),
+				elmt_data.masterTypeToString()};
 }
 
 /**
-	@brief projectDataBase::elementInfoToString
+	@brief projectDataBase::elementInfoValues
 	@param elmt
-	@return the element information in hash as key for the info name and value as the information value.
+	@return the values of a row of the element_info table for elmt :
+	the uuid followed by the information in the order of QETInformation::elementInfoKeys()
 */
-QHash<QString, QString> projectDataBase::elementInfoToString(Element *elmt)
+QVariantList projectDataBase::elementInfoValues(Element *elmt)
 {
-	QHash<QString, QString> hash; //Store the value for each columns
-	for (auto key : QETInformation::elementInfoKeys())
+	QVariantList values {elmt->uuid().toString()};
+	const auto infos = elmt->elementInformations();
+	for (const auto &key : QETInformation::elementInfoKeys())
 	{
-		if (key == "label") {
-			hash.insert(key, elmt->actualLabel());
-		}
-		else {
-			hash.insert(key, elmt->elementInformations()[key].toString());
+		if (key == QLatin1String("label")) {
+			values << elmt->actualLabel();
+		} else {
+			values << infos.value(key).toString();
 		}
 	}
 
-	return hash;
+	return values;
 }
 
-void projectDataBase::bindDiagramInfoValues(QSqlQuery &query, Diagram *diagram)
+/**
+	@brief projectDataBase::diagramValues
+	@param diagram
+	@return the values of a row of the diagram table for diagram :
+	uuid and pos
+*/
+QVariantList projectDataBase::diagramValues(Diagram *diagram) const
 {
-	query.bindValue(":uuid", diagram->uuid());
+	return QVariantList {diagram->uuid().toString(),
+				m_project->folioIndex(diagram)+1};
+}
 
-	auto infos = diagram->border_and_titleblock.titleblockInformation();
-	for (auto key : QETInformation::diagramInfoKeys())
+/**
+	@brief projectDataBase::diagramInfoValues
+	@param diagram
+	@return the values of a row of the diagram_info table for diagram :
+	the uuid followed by the information in the order of QETInformation::diagramInfoKeys()
+*/
+QVariantList projectDataBase::diagramInfoValues(Diagram *diagram)
+{
+	QVariantList values {diagram->uuid().toString()};
+	const auto infos = diagram->border_and_titleblock.titleblockInformation();
+	for (const auto &key : QETInformation::diagramInfoKeys())
 	{
-		if (key == "date") {
-			query.bindValue( ":date",
-							 QLocale::system().toDate(infos.value("date").toString(),
-													  QLocale::ShortFormat));
+		if (key == QLatin1String("date")) {
+			values << QLocale::system().toDate(infos.value("date").toString(),
+							   QLocale::ShortFormat);
 		} else {
-			auto value = infos.value(key);
-			auto bind = key.prepend(":");
-			query.bindValue(bind, value);
+			values << infos.value(key);
 		}
 	}
+
+	return values;
+}
+
+void projectDataBase::bindDiagramInfoValues(QSqlQuery &query, Diagram *diagram)
+{
+	const auto values = diagramInfoValues(diagram);
+	const auto keys = QETInformation::diagramInfoKeys();
+	query.bindValue(":uuid", values.first());
+	for (int i = 0 ; i < keys.size() ; ++i) {
+		query.bindValue(QStringLiteral(":") + keys.at(i), values.at(i+1));
+	}
 }
 
 #ifdef QET_EXPORT_PROJECT_DB
@@ -22,6 +22,7 @@
 #include <QSqlDatabase>
 #include <QSqlQuery>
 #include <QPointer>
+#include <QSet>
 #include <QFileDialog>
 
 class Element;
@@ -45,8 +46,11 @@ class projectDataBase : public QObject
 		virtual ~projectDataBase() override;
 
 		void updateDB();
+		void updatePendingChanges();
 		QETProject *project() const;
 		QSqlQuery newQuery(const QString &query = QString());
+		QVector<QStringList> queryRecords(const QString &query);
+		quint64 generation() const {return m_generation;}
 
 		void addElement         (Element *element);
 		void removeElement      (Element *element);
@@ -70,24 +74,42 @@ class projectDataBase : public QObject
 		void populateElementInfoTable();
 		void populateDiagramInfoTable();
 		void prepareQuery();
-		static QHash<QString, QString> elementInfoToString(
-				Element *elmt);
+		void schedulePendingChanges();
+		void flushPendingChanges();
+		bool writePendingChanges();
+		void notifyUpdated();
+		bool insertRows(const QString &statement,
+				int columns_count,
+				const QVector<QVariantList> &rows);
+		static QVariantList elementValues(Element *elmt);
+		static QVariantList elementInfoValues(Element *elmt);
+		QVariantList diagramValues(Diagram *diagram) const;
+		static QVariantList diagramInfoValues(Diagram *diagram);
 		void bindDiagramInfoValues(QSqlQuery &query, Diagram *diagram);
 
 	private:
 		QPointer<QETProject> m_project;
 		QSqlDatabase m_data_base;
-		QSqlQuery m_insert_elements_query,
-				  m_insert_element_info_query,
-				  m_remove_element_query,
-				  m_update_element_query,
+		QSqlQuery m_remove_element_query,
 				  m_insert_diagram_query,
 				  m_remove_diagram_query,
 				  m_insert_diagram_info_query,
-				  m_update_diagram_info_query,
 				  m_diagram_order_changed,
 				  m_diagram_info_order_changed;
 
+			//Changes not yet written in the database,
+			//applied all together by updatePendingChanges()
+		QHash<QString, QPointer<Element>> m_dirty_elements;
+		QSet<QString> m_removed_elements;
+		QHash<QString, QPointer<Diagram>> m_dirty_diagrams;
+		bool m_pending_scheduled = false;
+		bool m_notify_scheduled = false;
+
+			//Incremented each time the content of the database change,
+			//the results of queryRecords are valid for one generation.
+		quint64 m_generation = 0;
+		QHash<QString, QVector<QStringList>> m_query_cache;
+
 #ifdef QET_EXPORT_PROJECT_DB
 	public:
 		static sqlite3 *sqliteHandle(QSqlDatabase *db);
@@ -38,6 +38,7 @@
 #include "qetgraphicsitem/terminal.h"
 #include "qetxml.h"
 #include "undocommand/addelementtextcommand.h"
+#include "utils/qetsettings.h"
 
 #include <cassert>
 #include <math.h>
@@ -115,6 +116,18 @@ Diagram::Diagram(QETProject *project) :
 	connect(&border_and_titleblock,
 		&BorderTitleBlock::borderChanged,
 		this, &Diagram::adjustSceneRect);
+	connect(&border_and_titleblock,
+		&BorderTitleBlock::informationChanged,
+		this, &Diagram::invalidateBackup);
+	connect(&border_and_titleblock,
+		&BorderTitleBlock::titleBlockFolioChanged,
+		this, &Diagram::invalidateBackup);
+	connect(&border_and_titleblock,
+		&BorderTitleBlock::borderChanged,
+		this, &Diagram::invalidateBackup);
+	connect(&border_and_titleblock,
+		&BorderTitleBlock::displayChanged,
+		this, &Diagram::invalidateBackup);
 	connect(this, &Diagram::diagramActivated,
 		this, &Diagram::loadElmtFolioSeq);
 	connect(this, &Diagram::diagramActivated,
@@ -158,6 +171,20 @@ Diagram::~Diagram()
 	}
 }
 
+/**
+	@brief Diagram::invalidateBackup
+	Mark this folio as changed, it will be serialized again
+	by the next backup of the project.
+	Called by the project when its undo stack changes,
+	and by the setters of the properties which aren't
+	undoable commands.
+	@see QETProject::writeBackup
+*/
+void Diagram::invalidateBackup()
+{
+	m_backup_dirty = true;
+}
+
 /**
 	@brief Diagram::drawBackground
 	Draw the background of the diagram, ie the grid.
@@ -201,27 +228,34 @@ void Diagram::drawBackground(QPainter *p, const QRectF &r) {
 
 		// If user allow zoom out beyond of folio,
 		// we draw grid outside of border.
-		QSettings settings;
-		int xGrid = settings.value(QStringLiteral("diagrameditor/Xgrid"),
-								   Diagram::xGrid).toInt();
-		int yGrid = settings.value(QStringLiteral("diagrameditor/Ygrid"),
-								   Diagram::yGrid).toInt();
-		QRectF rect = settings.value(
-					QStringLiteral("diagrameditor/zoom-out-beyond-of-folio"),
-					false).toBool() ? r
-							: border_and_titleblock
-							  .insideBorderRect()
-							  .intersected(r);
+		QRectF rect = QetSettings::zoomOutBeyondOfFolio()
+				? r
+				: border_and_titleblock.insideBorderRect().intersected(r);
+
+			// Level of detail : when the points of the grid are too close
+			// on screen, only one point of 2 (4, 8...) is drawn,
+			// the number of drawn points only depends of the size of the view.
+		const qreal grid_min_spacing = 5.0; // in pixels
+		const qreal scale_x = qAbs(p -> worldTransform().m11());
+		const qreal scale_y = qAbs(p -> worldTransform().m22());
+		int xGrid = QetSettings::gridXStep();
+		int yGrid = QetSettings::gridYStep();
+		while (xGrid * scale_x < grid_min_spacing && xGrid < rect.width()) {
+			xGrid *= 2;
+		}
+		while (yGrid * scale_y < grid_min_spacing && yGrid < rect.height()) {
+			yGrid *= 2;
+		}
 
 		qreal limite_x = rect.x() + rect.width();
 		qreal limite_y = rect.y() + rect.height();
 
-		int g_x = (int)ceil(rect.x());
-		while (g_x % xGrid) ++ g_x;
-		int g_y = (int)ceil(rect.y());
-		while (g_y % yGrid) ++ g_y;
+		int g_x = (int)ceil(rect.x() / xGrid) * xGrid;
+		int g_y = (int)ceil(rect.y() / yGrid) * yGrid;
 
 		QPolygon points;
+		points.reserve(qMax(0, int((limite_x - g_x) / xGrid) + 1)
+			       * qMax(0, int((limite_y - g_y) / yGrid) + 1));
 		for (int gx = g_x ; gx < limite_x ; gx += xGrid) {
 			for (int gy = g_y ; gy < limite_y ; gy += yGrid) {
 				points << QPoint(gx, gy);
@@ -594,6 +628,7 @@ QString Diagram::conductorsAutonumName() const
 */
 void Diagram::setConductorsAutonumName(const QString &name) {
 	m_conductors_autonum_name= name;
+	invalidateBackup();
 }
 
 /**
@@ -715,19 +750,18 @@ bool Diagram::isEmpty() const
 QList < QSet <Conductor *> > Diagram::potentials()
 {
 	QList < QSet <Conductor *> > potential_List;
-	if (content().conductors().size() == 0)
-		return (potential_List); //return an empty potential
-	QList <Conductor *> conductors_list = content().conductors();
-
-	do {
-		QSet <Conductor *> one_potential =
-				conductors_list.first()
-				-> relatedPotentialConductors();
-		one_potential << conductors_list.takeFirst();
-		foreach (Conductor *c, one_potential)
-			conductors_list.removeOne(c);
+	QSet <Conductor *> done;
+
+	for (Conductor *c : content().conductors())
+	{
+		if (done.contains(c))
+			continue;
+
+		QSet <Conductor *> one_potential = c -> relatedPotentialConductors();
+		one_potential << c;
+		done.unite(one_potential);
 		potential_List << one_potential;
-	} while (!conductors_list.empty());
+	}
 
 	return (potential_List);
 }
@@ -1577,6 +1611,19 @@ void Diagram::refreshContents()
 	}
 }
 
+/**
+	@brief Diagram::refreshTables
+	Update the outdated models of the tables of this diagram,
+	the models are not updated while their tables are not displayed.
+	Called before this diagram is displayed, exported or printed.
+*/
+void Diagram::refreshTables()
+{
+	for (auto &table : qAsConst(m_tables)) {
+		table->refreshModel();
+	}
+}
+
 /**
 	@brief Diagram::addItem
 	Réimplemented from QGraphicsScene::addItem(QGraphicsItem *item)
@@ -1592,18 +1639,32 @@ void Diagram::addItem(QGraphicsItem *item)
 	{
 		case Element::Type:
 		{
-			m_project->dataBase()->addElement(
-						static_cast<Element *>(item));
+			Element *element = static_cast<Element *>(item);
+			m_elements.append(element);
+			m_elements_by_uuid.insert(element->uuid(), element);
+			m_project->dataBase()->addElement(element);
+			m_project->potentialIndex()->elementAdded(element);
 			break;
 		}
 		case Conductor::Type:
 		{
 			Conductor *conductor = static_cast<Conductor *>(item);
+			m_conductors.append(conductor);
 			conductor->terminal1->addConductor(conductor);
 			conductor->terminal2->addConductor(conductor);
 			conductor->calculateTextItemPosition();
 			break;
 		}
+		case IndependentTextItem::Type:
+		{
+			m_independent_texts.append(static_cast<IndependentTextItem *>(item));
+			break;
+		}
+		case QetGraphicsTableItem::Type:
+		{
+			m_tables.append(static_cast<QetGraphicsTableItem *>(item));
+			break;
+		}
 		default: {break;}
 	}
 }
@@ -1625,6 +1686,7 @@ void Diagram::removeItem(QGraphicsItem *item)
 			auto elmt = static_cast<Element*>(item);
 			elmt->unlinkAllElements();
 			m_project->dataBase()->removeElement(elmt);
+			m_project->potentialIndex()->elementRemoved(elmt);
 			break;
 		}
 		case Conductor::Type:
@@ -1637,8 +1699,63 @@ void Diagram::removeItem(QGraphicsItem *item)
 		default: {break;}
 	}
 
+	unregisterItem(item);
 	QGraphicsScene::removeItem(item);
 }
+
+/**
+	@brief Diagram::unregisterItem
+	Remove item from the lists of items of this diagram
+	(elements(), conductors(), independentTexts(), tables()).
+	Called by removeItem, and by the items deleted
+	while they are still in the diagram.
+	@param item
+*/
+void Diagram::unregisterItem(QGraphicsItem *item)
+{
+	switch (item->type())
+	{
+		case Element::Type:
+		{
+			Element *element = static_cast<Element *>(item);
+			if (m_elements.removeOne(element)
+				&& m_elements_by_uuid.value(element->uuid()) == element) {
+				m_elements_by_uuid.remove(element->uuid());
+			}
+			break;
+		}
+		case Conductor::Type:
+			m_conductors.removeOne(static_cast<Conductor *>(item));
+			break;
+		case IndependentTextItem::Type:
+			m_independent_texts.removeOne(static_cast<IndependentTextItem *>(item));
+			break;
+		case QetGraphicsTableItem::Type:
+			m_tables.removeOne(static_cast<QetGraphicsTableItem *>(item));
+			break;
+		default: {break;}
+	}
+}
+
+/**
+	@brief Diagram::elementUuidChanged
+	Update the uuid index of the elements,
+	must be called when the uuid of an element of this diagram change
+	(an element is added to the diagram before being loaded from xml).
+	@param element
+	@param old_uuid
+*/
+void Diagram::elementUuidChanged(Element *element, const QUuid &old_uuid)
+{
+	if (!m_elements.contains(element)) {
+		return;
+	}
+
+	if (m_elements_by_uuid.value(old_uuid) == element) {
+		m_elements_by_uuid.remove(old_uuid);
+	}
+	m_elements_by_uuid.insert(element->uuid(), element);
+}
 /**
 	@brief Diagram::titleChanged
 	emit(diagramTitleChanged(this, title));
@@ -2077,12 +2194,7 @@ QString Diagram::title() const
 */
 QList <Element *> Diagram::elements() const
 {
-	QList<Element *> element_list;
-	foreach (QGraphicsItem *qgi, items()) {
-		if (Element *elmt = qgraphicsitem_cast<Element *>(qgi))
-			element_list <<elmt;
-	}
-	return (element_list);
+	return (m_elements);
 }
 
 /**
@@ -2091,12 +2203,36 @@ QList <Element *> Diagram::elements() const
 */
 QList <Conductor *> Diagram::conductors() const
 {
-	QList<Conductor *> cnd_list;
-	foreach (QGraphicsItem *qgi, items()) {
-		if (Conductor *cnd = qgraphicsitem_cast<Conductor *>(qgi))
-			cnd_list <<cnd;
-	}
-	return (cnd_list);
+	return (m_conductors);
+}
+
+/**
+	@brief Diagram::independentTexts
+	@return the list containing all independent texts
+*/
+QList<IndependentTextItem *> Diagram::independentTexts() const
+{
+	return m_independent_texts;
+}
+
+/**
+	@brief Diagram::tables
+	@return the list containing all tables
+*/
+QList<QetGraphicsTableItem *> Diagram::tables() const
+{
+	return m_tables;
+}
+
+/**
+	@brief Diagram::elementFromUuid
+	@param uuid
+	@return the element of this diagram with the uuid uuid,
+	or nullptr if there is not.
+*/
+Element *Diagram::elementFromUuid(const QUuid &uuid) const
+{
+	return m_elements_by_uuid.value(uuid, nullptr);
 }
 
 /**
@@ -2175,6 +2311,7 @@ void Diagram::unfreezeElements()
 */
 void Diagram::setFreezeNewElements(bool b) {
 	m_freeze_new_elements = b;
+	invalidateBackup();
 }
 
 /**
@@ -2202,6 +2339,7 @@ void Diagram::freezeConductors(bool freeze) {
 */
 void Diagram::setFreezeNewConductors(bool b) {
 	m_freeze_new_conductors_ = b;
+	invalidateBackup();
 }
 
 /**
@@ -2250,6 +2388,10 @@ ExportProperties Diagram::applyProperties(
 	old_properties.exported_area = useBorder() ? QET::BorderArea
 						   : QET::ElementsArea;
 
+	// the rendering options are applied before each export or print,
+	// the content of the tables must be up to date
+	refreshTables();
+
 	// apply the new rendering options
 	// applique les nouvelles options de rendu
 	setUseBorder             (new_properties.exported_area == QET::BorderArea);
@@ -2293,11 +2435,8 @@ DiagramPosition Diagram::convertPosition(const QPointF &pos) {
 */
 QPointF Diagram::snapToGrid(const QPointF &p)
 {
-	QSettings settings;
-	int xGrid = settings.value(QStringLiteral("diagrameditor/Xgrid"),
-							   Diagram::xGrid).toInt();
-	int yGrid = settings.value(QStringLiteral("diagrameditor/Ygrid"),
-							   Diagram::yGrid).toInt();
+	int xGrid = QetSettings::gridXStep();
+	int yGrid = QetSettings::gridYStep();
 
 	//Return a point rounded to the nearest pixel
 	if (QApplication::keyboardModifiers().testFlag(Qt::ControlModifier))
@@ -2415,16 +2554,10 @@ bool Diagram::isReadOnly() const
 DiagramContent Diagram::content() const
 {
 	DiagramContent dc;
-	foreach(QGraphicsItem *qgi, items()) {
-		if (Element *e = qgraphicsitem_cast<Element *>(qgi)) {
-			dc.m_elements << e;
-		} else if (IndependentTextItem *iti =
-			   qgraphicsitem_cast<IndependentTextItem *>(qgi)) {
-			dc.m_text_fields << iti;
-		} else if (Conductor *c =
-			   qgraphicsitem_cast<Conductor *>(qgi)) {
-			dc.m_conductors_to_move << c;
-		}
+	dc.m_elements = m_elements;
+	dc.m_conductors_to_move = m_conductors;
+	for (IndependentTextItem *iti : m_independent_texts) {
+		dc.m_text_fields << iti;
 	}
 	return(dc);
 }
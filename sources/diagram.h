@@ -39,7 +39,9 @@ class DiagramPosition;
 class DiagramTextItem;
 class Element;
 class ElementsLocation;
+class IndependentTextItem;
 class QETProject;
+class QetGraphicsTableItem;
 class Terminal;
 class DiagramImageItem;
 class DiagramEventInterface;
@@ -128,6 +130,17 @@ class Diagram : public QGraphicsScene
 		bool m_freeze_new_elements;
 		bool m_freeze_new_conductors_;
 		QUuid m_uuid = QUuid::createUuid();
+
+			///Items of this diagram by type, updated by addItem and removeItem
+		QList<Element *> m_elements;
+		QList<Conductor *> m_conductors;
+		QList<IndependentTextItem *> m_independent_texts;
+		QList<QetGraphicsTableItem *> m_tables;
+		QHash<QUuid, Element *> m_elements_by_uuid;
+
+			///True if the folio may have changed since its last backup,
+			///read and reset by QETProject::writeBackup
+		bool m_backup_dirty = true;
 	
 	// METHODS
 	protected:
@@ -151,6 +164,7 @@ class Diagram : public QGraphicsScene
 		//methods related to autonum
 		QString conductorsAutonumName() const;
 		void setConductorsAutonumName(const QString &name);
+		void invalidateBackup();
 
 		static bool clipboardMayContainDiagram();
 	
@@ -195,10 +209,13 @@ class Diagram : public QGraphicsScene
 					     const QString&);
 	
 		void refreshContents();
+		void refreshTables();
 	
 		// methods related to graphics items addition/removal on the diagram
 		virtual void addItem    (QGraphicsItem *item);
 		virtual void removeItem (QGraphicsItem *item);
+		void unregisterItem(QGraphicsItem *item);
+		void elementUuidChanged(Element *element, const QUuid &old_uuid);
 	
 		// methods related to graphics options
 		ExportProperties applyProperties(const ExportProperties &);
@@ -225,6 +242,9 @@ class Diagram : public QGraphicsScene
 	
 		QList<Element *> elements() const;
 		QList<Conductor *> conductors() const;
+		QList<IndependentTextItem *> independentTexts() const;
+		QList<QetGraphicsTableItem *> tables() const;
+		Element *elementFromUuid(const QUuid &uuid) const;
 		QSet<Conductor *> selectedConductors() const;
 		DiagramContent content() const;
 		bool canRotateSelection() const;
@@ -116,6 +116,16 @@ void PasteDiagramCommand::redo()
 		qgi -> setSelected(true);
 }
 
+/**
+	@brief PasteDiagramCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool PasteDiagramCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	diagrams.insert(diagram);
+	return true;
+}
+
 /**
 	@brief CutDiagramCommand::CutDiagramCommand
 	Constructeur
@@ -209,6 +219,16 @@ void MoveConductorsTextsCommand::redo()
 	}
 }
 
+/**
+	@brief MoveConductorsTextsCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool MoveConductorsTextsCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	diagrams.insert(diagram);
+	return true;
+}
+
 /**
 	@brief MoveConductorsTextsCommand::addTextMovement
 	Ajout un mouvement de champ de texte a cet objet
@@ -303,6 +323,16 @@ void ChangeDiagramTextCommand::redo()
 	text_item->setHtml(text_after);
 }
 
+/**
+	@brief ChangeDiagramTextCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool ChangeDiagramTextCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	diagrams.insert(diagram);
+	return true;
+}
+
 /**
 	@brief ChangeConductorCommand::ChangeConductorCommand
 	Constructeur
@@ -363,6 +393,16 @@ void ChangeConductorCommand::redo()
 	}
 }
 
+/**
+	@brief ChangeConductorCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool ChangeConductorCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	diagrams.insert(diagram);
+	return true;
+}
+
 /**
 	@brief ChangeConductorCommand::setConductorTextItemMove
 	Integre dans cet objet d'annulation le repositionnement du champ de texte
@@ -427,6 +467,16 @@ void ResetConductorCommand::redo()
 	}
 }
 
+/**
+	@brief ResetConductorCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool ResetConductorCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	diagrams.insert(diagram);
+	return true;
+}
+
 /**
 	@brief ChangeBorderCommand::ChangeBorderCommand
 	Constructeur
@@ -475,3 +525,13 @@ void ChangeBorderCommand::redo()
 	diagram -> showMe();
 	diagram -> border_and_titleblock.importBorder(new_properties);
 }
+
+/**
+	@brief ChangeBorderCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool ChangeBorderCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	diagrams.insert(diagram);
+	return true;
+}
@@ -22,6 +22,7 @@
 #include "conductorprofile.h"
 #include "borderproperties.h"
 #include "undocommand/deleteqgraphicsitemcommand.h"
+#include "undocommand/diagramsundocommand.h"
 
 class DiagramTextItem;
 
@@ -29,7 +30,7 @@ class DiagramTextItem;
 	@brief The PasteDiagramCommand class
 	This command pastes some content onto a particular diagram.
 */
-class PasteDiagramCommand : public QUndoCommand {
+class PasteDiagramCommand : public QUndoCommand, public DiagramsUndoCommand {
 	// constructors, destructor
 	public:
 	PasteDiagramCommand(Diagram *, const DiagramContent &,
@@ -42,6 +43,7 @@ class PasteDiagramCommand : public QUndoCommand {
 	public:
 	void undo() override;
 	void redo() override;
+	bool changedDiagrams(QSet<Diagram *> &) const override;
 	
 	// attributes
 	private:
@@ -74,7 +76,7 @@ class CutDiagramCommand : public DeleteQGraphicsItemCommand {
 	This command moves text items related to conductors
 	on a particular diagram.
 */
-class MoveConductorsTextsCommand : public QUndoCommand {
+class MoveConductorsTextsCommand : public QUndoCommand, public DiagramsUndoCommand {
 	// constructors, destructor
 	public:
 	MoveConductorsTextsCommand(Diagram *, QUndoCommand * = nullptr);
@@ -86,6 +88,7 @@ class MoveConductorsTextsCommand : public QUndoCommand {
 	public:
 	void undo() override;
 	void redo() override;
+	bool changedDiagrams(QSet<Diagram *> &) const override;
 	virtual void addTextMovement(ConductorTextItem *,
 				     const QPointF &,
 				     const QPointF &,
@@ -108,7 +111,7 @@ class MoveConductorsTextsCommand : public QUndoCommand {
 	@brief The ChangeDiagramTextCommand class
 	This command modifies a text item.
 */
-class ChangeDiagramTextCommand : public QUndoCommand {
+class ChangeDiagramTextCommand : public QUndoCommand, public DiagramsUndoCommand {
 	// constructors, destructor
 	public:
 	ChangeDiagramTextCommand(DiagramTextItem *,
@@ -123,6 +126,7 @@ class ChangeDiagramTextCommand : public QUndoCommand {
 	public:
 	void undo() override;
 	void redo() override;
+	bool changedDiagrams(QSet<Diagram *> &) const override;
 	
 	// attributes
 	private:
@@ -141,7 +145,7 @@ class ChangeDiagramTextCommand : public QUndoCommand {
 	@brief The ChangeConductorCommand class
 	This command changes a particular conductor.
 */
-class ChangeConductorCommand : public QUndoCommand {
+class ChangeConductorCommand : public QUndoCommand, public DiagramsUndoCommand {
 	// constructors, destructor
 	public:
 	ChangeConductorCommand(Conductor *, const ConductorProfile &,
@@ -155,6 +159,7 @@ class ChangeConductorCommand : public QUndoCommand {
 	public:
 	void undo() override;
 	void redo() override;
+	bool changedDiagrams(QSet<Diagram *> &) const override;
 	virtual void setConductorTextItemMove(const QPointF &, const QPointF &);
 	
 	// attributes
@@ -180,7 +185,7 @@ class ChangeConductorCommand : public QUndoCommand {
 	@brief The ResetConductorCommand class
 	This command resets conductor paths.
 */
-class ResetConductorCommand : public QUndoCommand {
+class ResetConductorCommand : public QUndoCommand, public DiagramsUndoCommand {
 	// constructors, destructor
 	public:
 	ResetConductorCommand(const QHash<Conductor *,
@@ -194,6 +199,7 @@ class ResetConductorCommand : public QUndoCommand {
 	public:
 	void undo() override;
 	void redo() override;
+	bool changedDiagrams(QSet<Diagram *> &) const override;
 	
 	// attributes
 	private:
@@ -208,7 +214,7 @@ class ResetConductorCommand : public QUndoCommand {
 	@brief The ChangeBorderCommand class
 	This command changes the border properties of a particular diagram.
 */
-class ChangeBorderCommand : public QUndoCommand {
+class ChangeBorderCommand : public QUndoCommand, public DiagramsUndoCommand {
 	// constructors, destructor
 	public:
 	ChangeBorderCommand(Diagram *, const BorderProperties &,
@@ -221,6 +227,7 @@ class ChangeBorderCommand : public QUndoCommand {
 	public:
 	void undo() override;
 	void redo() override;
+	bool changedDiagrams(QSet<Diagram *> &) const override;
 	
 	// attributes
 	private:
@@ -32,6 +32,7 @@
 #include "ui/multipastedialog.h"
 #include "undocommand/changetitleblockcommand.h"
 #include "utils/conductorcreator.h"
+#include "utils/qetsettings.h"
 #include "undocommand/addgraphicsobjectcommand.h"
 #include "diagram.h"
 
@@ -64,7 +65,6 @@ DiagramView::DiagramView(Diagram *diagram, QWidget *parent) :
 	setRenderHint(QPainter::SmoothPixmapTransform, true);
 
 	setScene(m_diagram);
-	m_diagram -> undoStack().setClean();
 	setWindowIcon(QET::Icons::QETLogo);
 	setTransformationAnchor(QGraphicsView::AnchorUnderMouse);
 	setResizeAnchor(QGraphicsView::AnchorUnderMouse);
@@ -332,8 +332,7 @@ void DiagramView::zoom(const qreal zoom_factor)
 	}
 	else
 	{
-		QSettings settings;
-		if (settings.value("diagrameditor/zoom-out-beyond-of-folio", false).toBool() ||
+		if (QetSettings::zoomOutBeyondOfFolio() ||
 			(horizontalScrollBar()->maximum() || verticalScrollBar()->maximum()) )
 			if (zoom_factor >= 0){
 				scale(zoom_factor, zoom_factor);
@@ -917,8 +916,7 @@ void DiagramView::adjustSceneRect()
 	QRectF scene_rect = m_diagram->sceneRect();
 	scene_rect.adjust(-Diagram::margin, -Diagram::margin, Diagram::margin, Diagram::margin);
 
-	QSettings settings;
-	if (settings.value("diagrameditor/zoom-out-beyond-of-folio", false).toBool())
+	if (QetSettings::zoomOutBeyondOfFolio())
 	{
 			//When zoom out beyond of folio is active,
 			//we always adjust the scene rect to be 1/3 bigger than the wiewport
@@ -1034,6 +1032,10 @@ void DiagramView::resetConductors()
 	@return
 */
 bool DiagramView::event(QEvent *e) {
+	if (e -> type() == QEvent::Show) {
+			// the tables are not updated while the diagram is hidden
+		m_diagram -> refreshTables();
+	}
 	if (Q_UNLIKELY(m_first_activation)) {
 		if (e -> type() == QEvent::Show) {
 			zoomFit();
@@ -56,14 +56,13 @@ ElementProvider::ElementProvider(Diagram *diag) {
 QVector <QPointer<Element>> ElementProvider::freeElement(ElementData::Types filter) const
 {
 	QVector<QPointer<Element>> free_elmt;
-	QList<Element *> elmt_list;
 
 		//search in all diagram
 	for (const auto &diagram_ : qAsConst(m_diagram_list))
 	{
 			//get all element in diagram d
-		elmt_list = diagram_->elements();
-		for (const auto &elmt_ : qAsConst(elmt_list))
+		const QList<Element *> elmt_list = diagram_->elements();
+		for (const auto &elmt_ : elmt_list)
 		{
 			if (filter & elmt_->elementData().m_type &&
 				elmt_->isFree())
@@ -71,8 +70,6 @@ QVector <QPointer<Element>> ElementProvider::freeElement(ElementData::Types filt
 				free_elmt << elmt_;
 			}
 		}
-			//Clear for next loop
-		elmt_list.clear();
 	}
 
 	return free_elmt;
@@ -86,13 +83,21 @@ QList <Element *> ElementProvider::fromUuids(QList<QUuid> uuid_list) const
 {
 	QList <Element *> found_element;
 
-	foreach (Diagram *d, m_diagram_list) {
-		foreach(Element *elmt, d->elements()) {
-			if (uuid_list.contains(elmt->uuid())) {
+	for (Diagram *d : qAsConst(m_diagram_list))
+	{
+		for (auto it = uuid_list.begin() ; it != uuid_list.end() ;)
+		{
+			if (Element *elmt = d->elementFromUuid(*it)) {
 				found_element << elmt;
-				uuid_list.removeAll(elmt->uuid());
+				it = uuid_list.erase(it);
+			} else {
+				++it;
 			}
 		}
+
+		if (uuid_list.isEmpty()) {
+			break;
+		}
 	}
 	return found_element;
 }
@@ -154,21 +159,17 @@ QVector<QetGraphicsTableItem *> ElementProvider::table(
 	}
 
 	for (auto d : m_diagram_list) {
-		for (auto item_ : d->items())
+		const auto tables_ = d->tables();
+		for (auto found_table : tables_)
 		{
-			if(item_->type() == QetGraphicsTableItem::Type)
-			{
-				auto found_table = static_cast<QetGraphicsTableItem *>(item_);
-
-				if (linked_vector.contains(found_table)) {
-					continue;
-				}
-
-				if (!model ||
-					(found_table->model() &&
-					 model->metaObject()->className() == found_table->model()->metaObject()->className()))
-				{v_.append(found_table);}
+			if (linked_vector.contains(found_table)) {
+				continue;
 			}
+
+			if (!model ||
+				(found_table->model() &&
+				 model->metaObject()->className() == found_table->model()->metaObject()->className()))
+			{v_.append(found_table);}
 		}
 	}
 
@@ -182,9 +183,12 @@ QVector<QetGraphicsTableItem *> ElementProvider::table(
 */
 QetGraphicsTableItem *ElementProvider::tableFromUuid(const QUuid &uuid)
 {
-	for (auto table : this->table())
-		if (table->uuid() == uuid)
-			return table;
+	for (auto d : qAsConst(m_diagram_list)) {
+		const auto tables_ = d->tables();
+		for (auto table : tables_)
+			if (table->uuid() == uuid)
+				return table;
+	}
 
 	return nullptr;
 }
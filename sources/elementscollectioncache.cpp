@@ -22,9 +22,42 @@
 #include "qetgraphicsitem/element.h"
 
 #include <QImageWriter>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QSqlError>
 #include <QSqlQuery>
 
+namespace {
+	/**
+		@brief hashToJson
+		@param hash
+		@return hash written as a compact json object
+	*/
+	QString hashToJson(const QHash<QString, QString> &hash)
+	{
+		QJsonObject object;
+		for (auto it = hash.constBegin() ; it != hash.constEnd() ; ++it) {
+			object.insert(it.key(), it.value());
+		}
+		return QString::fromUtf8(QJsonDocument(object).toJson(QJsonDocument::Compact));
+	}
+
+	/**
+		@brief hashFromJson
+		@param json
+		@return the hash written in json by hashToJson
+	*/
+	QHash<QString, QString> hashFromJson(const QString &json)
+	{
+		QHash<QString, QString> hash;
+		const QJsonObject object = QJsonDocument::fromJson(json.toUtf8()).object();
+		for (auto it = object.constBegin() ; it != object.constEnd() ; ++it) {
+			hash.insert(it.key(), it.value().toString());
+		}
+		return hash;
+	}
+}
+
 /**
 	Construct a cache for elements collections.
 	@param database_path Path of the SQLite database to open.
@@ -72,6 +105,18 @@ ElementsCollectionCache::ElementsCollectionCache(const QString &database_path, Q
 					   "pixmap BLOB, PRIMARY KEY(path),"
 					   "FOREIGN KEY(path) REFERENCES names (path) ON DELETE CASCADE);");
 
+		cache_db_.exec("CREATE TABLE IF NOT EXISTS elements_index"
+					   "("
+					   "path VARCHAR(512) NOT NULL,"
+					   "mtime INTEGER NOT NULL,"
+					   "size INTEGER NOT NULL,"
+					   "uuid VARCHAR(512) NOT NULL,"
+					   "names TEXT,"
+					   "informations TEXT,"
+					   "search TEXT,"
+					   "PRIMARY KEY(path)"
+					   ");");
+
 			// prepare queries
 		select_name_   = new QSqlQuery(cache_db_);
 		select_pixmap_ = new QSqlQuery(cache_db_);
@@ -81,6 +126,8 @@ ElementsCollectionCache::ElementsCollectionCache(const QString &database_path, Q
 		select_pixmap_ -> prepare("SELECT pixmap FROM pixmaps WHERE path = :path AND uuid = :uuid");
 		insert_name_   -> prepare("REPLACE INTO names (path, locale, uuid, name) VALUES (:path, :locale, :uuid, :name)");
 		insert_pixmap_ -> prepare("REPLACE INTO pixmaps (path, uuid, pixmap) VALUES (:path, :uuid, :pixmap)");
+
+		loadIndex();
 	}
 }
 
@@ -89,6 +136,7 @@ ElementsCollectionCache::ElementsCollectionCache(const QString &database_path, Q
 */
 ElementsCollectionCache::~ElementsCollectionCache()
 {
+	saveIndex();
 	delete select_name_;
 	delete select_pixmap_;
 	delete insert_name_;
@@ -320,3 +368,238 @@ bool ElementsCollectionCache::cachePixmap(const QString &path,
 	}
 	return(true);
 }
+
+/**
+	@brief ElementsCollectionCache::fetchUuid
+	Retrieve the uuid of the element stored in the file at path.
+	This method only read the in memory index and can be called from any thread.
+	@param path : file system path of the element
+	@param mtime : last modification time of the file, in ms since epoch
+	@param size : size of the file
+	@param uuid : the found uuid is written here
+	@return True if the index contain an up to date uuid for path,
+	false otherwise.
+*/
+bool ElementsCollectionCache::fetchUuid(const QString &path,
+					qint64 mtime,
+					qint64 size,
+					QUuid *uuid)
+{
+	QMutexLocker locker(&index_mutex_);
+	auto it = index_.constFind(path);
+	if (it == index_.constEnd()
+		|| it->mtime != mtime
+		|| it->size != size) {
+		return(false);
+	}
+
+	seen_index_.insert(path);
+	if (uuid) {
+		*uuid = it->element.uuid;
+	}
+	return(true);
+}
+
+/**
+	@brief ElementsCollectionCache::cacheUuid
+	Store the uuid of the element stored in the file at path.
+	If the index already contain the other data of an unchanged file,
+	they are kept, otherwise the entry only contain the uuid.
+	The entry is kept in memory and written to the database by saveIndex().
+	This method can be called from any thread.
+	@param path : file system path of the element
+	@param mtime : last modification time of the file, in ms since epoch
+	@param size : size of the file
+	@param uuid : uuid of the element
+*/
+void ElementsCollectionCache::cacheUuid(const QString &path,
+					qint64 mtime,
+					qint64 size,
+					const QUuid &uuid)
+{
+	QMutexLocker locker(&index_mutex_);
+	IndexEntry &entry = index_[path];
+	if (entry.mtime != mtime || entry.size != size)
+	{
+		entry = IndexEntry();
+		entry.mtime = mtime;
+		entry.size = size;
+	}
+	entry.element.uuid = uuid;
+	dirty_index_.insert(path);
+	seen_index_.insert(path);
+}
+
+/**
+	@brief ElementsCollectionCache::fetchIndexedElement
+	Retrieve the data of the element stored in the file at path,
+	without parsing the file.
+	This method only read the in memory index and can be called from any thread.
+	@param path : file system path of the element
+	@param mtime : last modification time of the file, in ms since epoch
+	@param size : size of the file
+	@param element : the found data are written here
+	@return True if the index contain up to date data for path,
+	false if the file must be parsed.
+*/
+bool ElementsCollectionCache::fetchIndexedElement(const QString &path,
+						  qint64 mtime,
+						  qint64 size,
+						  IndexedElement *element)
+{
+	QMutexLocker locker(&index_mutex_);
+	auto it = index_.constFind(path);
+	if (it == index_.constEnd()
+		|| !it->complete
+		|| it->mtime != mtime
+		|| it->size != size) {
+		return(false);
+	}
+
+	seen_index_.insert(path);
+	if (element) {
+		*element = it->element;
+	}
+	return(true);
+}
+
+/**
+	@brief ElementsCollectionCache::cacheIndexedElement
+	Store the data of the element stored in the file at path.
+	The entry is kept in memory and written to the database by saveIndex().
+	This method can be called from any thread.
+	@param path : file system path of the element
+	@param mtime : last modification time of the file, in ms since epoch
+	@param size : size of the file
+	@param element : data of the element
+*/
+void ElementsCollectionCache::cacheIndexedElement(const QString &path,
+						  qint64 mtime,
+						  qint64 size,
+						  const IndexedElement &element)
+{
+	QMutexLocker locker(&index_mutex_);
+	IndexEntry entry;
+	entry.mtime = mtime;
+	entry.size = size;
+	entry.complete = true;
+	entry.element = element;
+	index_.insert(path, entry);
+	dirty_index_.insert(path);
+	seen_index_.insert(path);
+}
+
+/**
+	@brief ElementsCollectionCache::loadIndex
+	Load the whole elements_index table in memory.
+	An entry without names only contain the uuid of the element.
+*/
+void ElementsCollectionCache::loadIndex()
+{
+	QSqlQuery query(cache_db_);
+	if (!query.exec("SELECT path, mtime, size, uuid, names, informations, search FROM elements_index"))
+	{
+		qDebug() << cache_db_.lastError();
+		return;
+	}
+
+	QMutexLocker locker(&index_mutex_);
+	while (query.next())
+	{
+		IndexEntry entry;
+		entry.mtime = query.value(1).toLongLong();
+		entry.size  = query.value(2).toLongLong();
+		entry.element.uuid = QUuid(query.value(3).toString());
+		if (!query.value(4).isNull())
+		{
+			entry.complete = true;
+			entry.element.names        = hashFromJson(query.value(4).toString());
+			entry.element.informations = hashFromJson(query.value(5).toString());
+			entry.element.search       = query.value(6).toString();
+		}
+		index_.insert(query.value(0).toString(), entry);
+	}
+}
+
+/**
+	@brief ElementsCollectionCache::saveIndex
+	Write the entries of the index added since the last save
+	to the database, in one transaction.
+*/
+void ElementsCollectionCache::saveIndex()
+{
+	QMutexLocker locker(&index_mutex_);
+	if (!cache_db_.isOpen() || dirty_index_.isEmpty()) {
+		return;
+	}
+
+	cache_db_.transaction();
+	QSqlQuery query(cache_db_);
+	query.prepare("REPLACE INTO elements_index (path, mtime, size, uuid, names, informations, search) "
+		      "VALUES (:path, :mtime, :size, :uuid, :names, :informations, :search)");
+	for (const auto &path : qAsConst(dirty_index_))
+	{
+		const auto entry = index_.value(path);
+		query.bindValue(":path",  path);
+		query.bindValue(":mtime", entry.mtime);
+		query.bindValue(":size",  entry.size);
+		query.bindValue(":uuid",  entry.element.uuid.toString());
+		if (entry.complete)
+		{
+			query.bindValue(":names",        hashToJson(entry.element.names));
+			query.bindValue(":informations", hashToJson(entry.element.informations));
+			query.bindValue(":search",       entry.element.search);
+		}
+		else
+		{
+			query.bindValue(":names",        QVariant());
+			query.bindValue(":informations", QVariant());
+			query.bindValue(":search",       QVariant());
+		}
+		if (!query.exec()) {
+			qDebug() << cache_db_.lastError();
+		}
+	}
+	cache_db_.commit();
+	dirty_index_.clear();
+}
+
+/**
+	@brief ElementsCollectionCache::pruneIndex
+	Remove from the index and from the database the entries
+	not read nor written since the previous call of this method.
+	Call it after a walk of the whole collections, the removed entries
+	are then the element files deleted, renamed or moved since the walk before.
+*/
+void ElementsCollectionCache::pruneIndex()
+{
+	QMutexLocker locker(&index_mutex_);
+	QStringList removed_paths;
+	for (auto it = index_.begin() ; it != index_.end() ;)
+	{
+		if (seen_index_.contains(it.key())) {
+			++it;
+			continue;
+		}
+		removed_paths.append(it.key());
+		dirty_index_.remove(it.key());
+		it = index_.erase(it);
+	}
+	seen_index_.clear();
+
+	if (!cache_db_.isOpen() || removed_paths.isEmpty()) {
+		return;
+	}
+
+	cache_db_.transaction();
+	QSqlQuery query(cache_db_);
+	query.prepare("DELETE FROM elements_index WHERE path = :path");
+	for (const auto &path : qAsConst(removed_paths))
+	{
+		query.bindValue(":path", path);
+		if (!query.exec()) {
+			qDebug() << cache_db_.lastError();
+		}
+	}
+	cache_db_.commit();
+}
@@ -20,7 +20,11 @@
 
 #include "ElementsCollection/elementslocation.h"
 
+#include <QHash>
+#include <QMutex>
+#include <QSet>
 #include <QSqlDatabase>
+#include <QUuid>
 
 /**
 	This class implements a SQLite cache for data related to elements
@@ -52,6 +56,47 @@ class ElementsCollectionCache : public QObject
 		       const QUuid &uuid = QUuid::createUuid());
 	bool cachePixmap(const QString &path,
 			 const QUuid &uuid = QUuid::createUuid());
+	bool fetchUuid(const QString &path,
+		       qint64 mtime,
+		       qint64 size,
+		       QUuid *uuid);
+	void cacheUuid(const QString &path,
+		       qint64 mtime,
+		       qint64 size,
+		       const QUuid &uuid);
+
+	/**
+		Data of an element file displayed and searched by the elements
+		panel, stored in the index with the uuid of the element.
+	*/
+	struct IndexedElement
+	{
+		QUuid uuid;
+		QHash<QString, QString> names;        ///< Localized names, by language
+		QHash<QString, QString> informations; ///< Element informations, by key
+		QString search;                       ///< Values of the informations, the text searched by the elements panel
+	};
+	bool fetchIndexedElement(const QString &path,
+				 qint64 mtime,
+				 qint64 size,
+				 IndexedElement *element);
+	void cacheIndexedElement(const QString &path,
+				 qint64 mtime,
+				 qint64 size,
+				 const IndexedElement &element);
+	void saveIndex();
+	void pruneIndex();
+	
+	private:
+	void loadIndex();
+
+	struct IndexEntry
+	{
+		qint64 mtime = 0;
+		qint64 size = 0;
+		bool complete = false; ///< False if only the uuid is known
+		IndexedElement element;
+	};
 	
 	// attributes
 	private:
@@ -64,5 +109,9 @@ class ElementsCollectionCache : public QObject
 	QString pixmap_storage_format_; ///< Storage format for cached pixmaps
 	QString current_name_;          ///< Last name fetched
 	QPixmap current_pixmap_;        ///< Last pixmap fetched
+	QHash<QString, IndexEntry> index_; ///< In memory copy of the elements_index table
+	QSet<QString> dirty_index_;     ///< Paths of the entries not yet written to the database
+	QSet<QString> seen_index_;      ///< Paths of the entries read or written since the last pruneIndex()
+	mutable QMutex index_mutex_;    ///< Protect index_, dirty_index_ and seen_index_, the index can be read from any thread
 };
 #endif
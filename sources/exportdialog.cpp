@@ -36,6 +36,7 @@
 
 #include <QGraphicsSimpleTextItem>
 #include <QSvgGenerator>
+#include <QtConcurrent>
 #include <QtXml>
 #include <cmath>
 #include <utility>
@@ -227,12 +228,24 @@ qreal ExportDialog::diagramRatio(Diagram *diagram)
 	ou elements
 */
 QSize ExportDialog::diagramSize(Diagram *diagram)
+{
+	return(diagramSize(diagram, epw -> exportProperties()));
+}
+
+/**
+	@param diagram Un schema
+	@param export_properties the properties used for the export
+	@return les dimensions du schema, en tenant compte du type d'export : cadre
+	ou elements
+*/
+QSize ExportDialog::diagramSize(Diagram *diagram,
+				const ExportProperties &export_properties)
 {
 	// sauvegarde le parametre useBorder du schema
 	bool state_useBorder = diagram -> useBorder();
 	
 	// applique le useBorder adequat et calcule le ratio
-	diagram -> setUseBorder(epw -> exportProperties().exported_area == QET::BorderArea);
+	diagram -> setUseBorder(export_properties.exported_area == QET::BorderArea);
 	QSize diagram_size = diagram -> imageSize();
 	
 	// restaure le parametre useBorder du schema
@@ -342,15 +355,18 @@ void ExportDialog::slot_resetSize(int diagram_id)
 	@param width  Largeur de l'export
 	@param height Hauteur de l'export
 	@param keep_aspect_ratio True pour conserver le ratio, false sinon
+	@param export_properties the properties to apply to diagram for the export
 	@return l'image a exporter
 */
 QImage ExportDialog::generateImage(
 		Diagram *diagram,
 		int width,
 		int height,
-		bool keep_aspect_ratio)
+		bool keep_aspect_ratio,
+		const ExportProperties &export_properties)
 {
-	saveReloadDiagramParameters(diagram, true);
+	const ExportProperties diagram_properties =
+			diagram -> applyProperties(export_properties);
 	
 	QImage image(width, height, QImage::Format_RGB32);
 	diagram -> toPaintDevice(
@@ -360,48 +376,59 @@ QImage ExportDialog::generateImage(
 		keep_aspect_ratio ? Qt::KeepAspectRatio : Qt::IgnoreAspectRatio
 	);
 	
-	saveReloadDiagramParameters(diagram, false);
+	diagram -> applyProperties(diagram_properties);
 	
 	return(image);
 }
 
 /**
-	Sauve ou restaure les parametres du schema
-	@param diagram Schema dont on sauve ou restaure les parametres
-	@param save true pour memoriser les parametres du schema et appliquer ceux
-	definis par le formulaire, false pour restaurer les parametres
+	Exporte le schema en SVG
+	@param diagram Schema a exporter en SVG
+	@param width  Largeur de l'export SVG
+	@param height Hauteur de l'export SVG
+	@param keep_aspect_ratio True pour conserver le ratio, false sinon
+	@param io_device Peripherique de sortie pour le code SVG (souvent : un fichier)
+	@param export_properties the properties to apply to diagram for the export
 */
-void ExportDialog::saveReloadDiagramParameters(Diagram *diagram, bool save) {
-	static ExportProperties state_exportProperties;
-	
-	if (save) {
-		// memorise les parametres relatifs au schema tout en appliquant les nouveaux
-		state_exportProperties = diagram -> applyProperties(epw -> exportProperties());
-	} else {
-		// restaure les parametres relatifs au schema
-		diagram -> applyProperties(state_exportProperties);
-	}
+void ExportDialog::generateSvg(
+		Diagram *diagram,
+		int width,
+		int height,
+		bool keep_aspect_ratio,
+		QIODevice &io_device,
+		const ExportProperties &export_properties)
+{
+	const QPicture picture = generateSvgPicture(diagram,
+						    width,
+						    height,
+						    keep_aspect_ratio,
+						    export_properties);
+	writeSvg(picture, width, height, io_device);
 }
 
 /**
-	Exporte le schema en SVG
+	@brief ExportDialog::generateSvgPicture
+	Render the diagram in a QPicture, to be written as SVG by writeSvg.
+	Must be called from the thread of the diagram.
 	@param diagram Schema a exporter en SVG
 	@param width  Largeur de l'export SVG
 	@param height Hauteur de l'export SVG
 	@param keep_aspect_ratio True pour conserver le ratio, false sinon
-	@param io_device Peripherique de sortie pour le code SVG (souvent : un fichier)
+	@param export_properties the properties to apply to diagram for the export
+	@return the rendered diagram
 */
-void ExportDialog::generateSvg(
+QPicture ExportDialog::generateSvgPicture(
 		Diagram *diagram,
 		int width,
 		int height,
 		bool keep_aspect_ratio,
-		QIODevice &io_device)
+		const ExportProperties &export_properties)
 {
-	saveReloadDiagramParameters(diagram, true);
+	const ExportProperties diagram_properties =
+			diagram -> applyProperties(export_properties);
 
 	// set the transparency for the SVG-Background:
-	if (epw->exportProperties().draw_bg_transparent == true) {
+	if (export_properties.draw_bg_transparent == true) {
 		diagram->background_color.setAlpha(0);
 		} else {
 		diagram->background_color.setAlpha(255);
@@ -416,14 +443,32 @@ void ExportDialog::generateSvg(
 		keep_aspect_ratio ? Qt::KeepAspectRatio : Qt::IgnoreAspectRatio
 	);
 	
+	diagram -> applyProperties(diagram_properties);
+
+	return(picture);
+}
+
+/**
+	@brief ExportDialog::writeSvg
+	Write the picture of a diagram as SVG.
+	Doesn't use the diagram, so can be called from any thread.
+	@param picture the diagram rendered by generateSvgPicture
+	@param width  Largeur de l'export SVG
+	@param height Hauteur de l'export SVG
+	@param io_device Peripherique de sortie pour le code SVG (souvent : un fichier)
+*/
+void ExportDialog::writeSvg(
+		const QPicture &picture,
+		int width,
+		int height,
+		QIODevice &io_device)
+{
 	// "joue" la QPicture sur un QSvgGenerator
 	QSvgGenerator svg_engine;
 	svg_engine.setSize(QSize((width*9/16), (height*9/16)));
 	svg_engine.setOutputDevice(&io_device);
 	QPainter svg_painter(&svg_engine);
 	picture.play(&svg_painter);
-	
-	saveReloadDiagramParameters(diagram, false);
 }
 
 /**
@@ -432,29 +477,38 @@ void ExportDialog::generateSvg(
 	@param width  Largeur de l'export DXF
 	@param height Hauteur de l'export DXF
 	@param file_path
+	@param export_properties the properties to apply to diagram for the export
+	@return false if the file can't be written
 */
-void ExportDialog::generateDxf(
+bool ExportDialog::generateDxf(
 		Diagram *diagram,
-					int width,
-					int height,
-		QString &file_path)
+		int width,
+		int height,
+		QString &file_path,
+		const ExportProperties &export_properties)
 {
-	saveReloadDiagramParameters(diagram, true);
+	const ExportProperties diagram_properties =
+			diagram -> applyProperties(export_properties);
 
 	width  -= 2*Diagram::margin;
 	height -= 2*Diagram::margin;
 
-	Createdxf::xScale = Createdxf::sheetWidth  / double(width);
-	Createdxf::yScale = Createdxf::sheetHeight / double(height);
-
-	Createdxf::dxfBegin(file_path);
+		//All the primitives of the folio are written through one stream
+	Createdxf dxf(file_path,
+		      Createdxf::sheetWidth  / double(width),
+		      Createdxf::sheetHeight / double(height));
+	if (!dxf.isOpen()) {
+		diagram -> applyProperties(diagram_properties);
+		return false;
+	}
+	dxf.dxfBegin();
 
 	//Add project elements (lines, rectangles, circles, texts) to dxf file
-	if (epw -> exportProperties().draw_border) {
+	if (export_properties.draw_border) {
 		QRectF rect(Diagram::margin,Diagram::margin,width,height);
-		Createdxf::drawRectangle(file_path,rect,0);
+		dxf.drawRectangle(rect,0);
 	}
-	diagram -> border_and_titleblock.drawDxf(file_path, 0);
+	diagram -> border_and_titleblock.drawDxf(dxf, 0);
 
 	// Build the lists of elements.
 	QList<Element *> list_elements;
@@ -488,11 +542,11 @@ void ExportDialog::generateDxf(
 	}
 
 	// Draw shapes
-	foreach (QetShapeItem *qsi, list_shapes) qsi->toDXF(file_path, qsi->pen());
+	foreach (QetShapeItem *qsi, list_shapes) qsi->toDXF(dxf, qsi->pen());
 
 	// Draw tables
 	foreach (QetGraphicsTableItem *gti, list_tables) {
-		gti->toDXF(file_path);
+		gti->toDXF(dxf);
 	}
 
 	//Draw elements
@@ -505,7 +559,7 @@ void ExportDialog::generateDxf(
 
 		ElementPictureFactory::primitives primitives = ElementPictureFactory::instance()->getPrimitives(elmt->location());
 
-		for(QGraphicsSimpleTextItem *text : primitives.m_texts)
+		for(const auto &text : qAsConst(primitives.m_texts))
 		{
 			qreal fontSize = text->font().pointSizeF();
 			if (fontSize < 0)
@@ -527,7 +581,7 @@ void ExportDialog::generateDxf(
 			for (QString line : lines)
 			{
 				if (line.size() > 0 && line != "_" ) {
-					Createdxf::drawText(file_path, line, QPointF(x, y), fontSize, 360 - angle, 0, 0.72);
+					dxf.drawText(line, QPointF(x, y), fontSize, 360 - angle, 0, 0.72);
 				}
 				x += offset * xdir;
 				y -= offset * ydir;
@@ -538,21 +592,21 @@ void ExportDialog::generateDxf(
 		{
 			QTransform t = QTransform().translate(elem_pos_x,elem_pos_y).rotate(rotation_angle);
 			QLineF l = t.map(line);
-			Createdxf::drawLine(file_path, l, 0);
+			dxf.drawLine(l, 0);
 		}
 
 		for (QRectF rect : primitives.m_rectangles)
 		{
 			QTransform t = QTransform().translate(elem_pos_x,elem_pos_y).rotate(rotation_angle);
 			QRectF r = t.mapRect(rect);
-			Createdxf::drawRectangle(file_path,r,0);
+			dxf.drawRectangle(r,0);
 		}
 
 		for (QRectF circle_rect : primitives.m_circles)
 		{
 			QTransform t = QTransform().translate(elem_pos_x,elem_pos_y).rotate(rotation_angle);
 			QPointF c = t.map(QPointF(circle_rect.center().x(),circle_rect.center().y()));
-			Createdxf::drawCircle(file_path,c,circle_rect.width()/2,0);
+			dxf.drawCircle(c,circle_rect.width()/2,0);
 		}
 
 		for (QVector<QPointF> polygon : primitives.m_polygons)
@@ -562,9 +616,9 @@ void ExportDialog::generateDxf(
 			QTransform t = QTransform().translate(elem_pos_x,elem_pos_y).rotate(rotation_angle);
 			QPolygonF poly = t.map(polygon);
 			if(poly.isClosed())
-				Createdxf::drawPolygon(file_path,poly,0);
+				dxf.drawPolygon(poly,0);
 			else
-				Createdxf::drawPolyline(file_path,poly,0);
+				dxf.drawPolyline(poly,0);
 		}
 
 		// Draw arcs and ellipses
@@ -580,16 +634,16 @@ void ExportDialog::generateDxf(
 			qreal spanAngle = arc .at(5);
 			QRectF r(x,y,w,h);
 			QPointF hotspot(elem_pos_x,elem_pos_y);
-			Createdxf::drawArcEllipse(file_path, r, startAngle, spanAngle, hotspot, rotation_angle, 0);
+			dxf.drawArcEllipse(r, startAngle, spanAngle, hotspot, rotation_angle, 0);
 		}
-		if (epw -> exportProperties().draw_terminals) {
+		if (export_properties.draw_terminals) {
 			// Draw terminals
 			QList<Terminal *> list_terminals = elmt->terminals();
 			QColor col("red");
 			QTransform t = QTransform().translate(elem_pos_x,elem_pos_y).rotate(rotation_angle);
 			foreach(Terminal *tp, list_terminals) {
 				QPointF c = t.map(QPointF(tp->dock_elmt_.x(),tp->dock_elmt_.y()));
-				Createdxf::drawCircle(file_path,c,3.0,Createdxf::dxfColor(col));
+				dxf.drawCircle(c,3.0,Createdxf::dxfColor(col));
 			}
 		}
 	}
@@ -599,14 +653,14 @@ void ExportDialog::generateDxf(
 		QPolygonF poly;
 		bool firstseg = true;
 		foreach(ConductorSegment *segment, cond -> segmentsList()) {
-			//Createdxf::drawLine(file_path,QLineF(cond->pos()+segment->firstPoint(),cond->pos()+segment->secondPoint()),0);
+			//dxf.drawLine(QLineF(cond->pos()+segment->firstPoint(),cond->pos()+segment->secondPoint()),0);
 			if(firstseg){
 				poly << cond->pos()+segment->firstPoint();
 				firstseg = false;
 			}
 			poly << cond->pos()+segment->secondPoint();
 		}
-		Createdxf::drawPolyline(file_path,poly,0);
+		dxf.drawPolyline(poly,0);
 		//Draw conductor text item
 		ConductorTextItem *textItem = cond -> textItem();
 
@@ -629,7 +683,7 @@ void ExportDialog::generateDxf(
 			qreal offset = fontSize * 1.6;
 			foreach (QString line, lines) {
 				if (line.size() > 0 && line != "_" )
-					Createdxf::drawText(file_path, line, QPointF(x, y), fontSize, 360-angle, 0, 0.72 );
+					dxf.drawText(line, QPointF(x, y), fontSize, 360-angle, 0, 0.72 );
 				x += offset * xdir;
 				y -= offset * ydir;
 			}
@@ -639,7 +693,7 @@ void ExportDialog::generateDxf(
 		QList<QPointF> junctions_list = cond->junctions();
 		if (!junctions_list.isEmpty()) {
 			foreach(QPointF point, junctions_list) {
-				Createdxf::drawEllipse(file_path,QRectF(cond->pos().x() + point.x() - 1.5, cond->pos().y() + point.y() - 1.5, 3.0, 3.0),0);
+				dxf.drawEllipse(QRectF(cond->pos().x() + point.x() - 1.5, cond->pos().y() + point.y() - 1.5, 3.0, 3.0),0);
 			}
 		}
 	}
@@ -671,15 +725,16 @@ void ExportDialog::generateDxf(
 		qreal offset = fontSize * 1.6;
 		foreach (QString line, lines) {
 			if (line.size() > 0 && line != "_" )
-				Createdxf::drawText(file_path, line, QPointF(x, y), fontSize, 360-angle, Createdxf::dxfColor(dti->color()), 0.72 );
+				dxf.drawText(line, QPointF(x, y), fontSize, 360-angle, Createdxf::dxfColor(dti->color()), 0.72 );
 			x += offset * xdir;
 			y -= offset * ydir;
 		}
 	}
 
-	Createdxf::dxfEnd(file_path);
+	dxf.dxfEnd();
 
-	saveReloadDiagramParameters(diagram, false);
+	diagram -> applyProperties(diagram_properties);
+	return dxf.close();
 }
 
 QPointF ExportDialog::rotation_transformed(qreal px,
@@ -752,20 +807,94 @@ void ExportDialog::slot_export()
 	}
 	
 	// exporte chaque schema a exporter
-	foreach(ExportDiagramLine *diagram_line, diagrams_to_export) {
-		exportDiagram(diagram_line);
+	if (!exportDiagrams(diagrams_to_export)) {
+		return;
 	}
 	
 	// fermeture du dialogue
 	accept();
 }
 
+/**
+	@brief ExportDialog::exportDiagrams
+	Export the diagrams of diagram_lines, with a progress dialog.
+	The diagrams are rendered one after the other in the gui thread,
+	the encoding and the writing of the files are done in the global thread pool
+	while the next diagram is rendered.
+	The progress counts the rendered diagrams and the written files.
+	@param diagram_lines
+	@return false if the export was canceled by the user,
+	the diagrams already rendered are written anyway.
+*/
+bool ExportDialog::exportDiagrams(const QList<ExportDiagramLine *> &diagram_lines)
+{
+	QProgressDialog progress(tr("Export des folios en cours..."),
+				 tr("Annuler"),
+				 0,
+				 diagram_lines.count() * 2,
+				 this);
+	progress.setWindowModality(Qt::WindowModal);
+	progress.setMinimumDuration(500);
+
+		//Limit the memory used by the rendered diagrams waiting to be written
+	const qint64 max_pending_bytes = 256 * 1024 * 1024;
+	QList<QPair<QFuture<void>, qint64>> pending_writes;
+	qint64 pending_bytes = 0;
+	int done = 0;
+
+		//Forget the finished writes, and wait for the oldest writes
+		//while the data waiting to be written is bigger than max_bytes
+	auto updateWrites = [&](qint64 max_bytes)
+	{
+		while (!pending_writes.isEmpty()
+		       && (pending_bytes > max_bytes
+			   || pending_writes.first().first.isFinished()))
+		{
+			auto write = pending_writes.takeFirst();
+			write.first.waitForFinished();
+			pending_bytes -= write.second;
+			progress.setValue(++done);
+		}
+	};
+
+	for (ExportDiagramLine *diagram_line : diagram_lines)
+	{
+		if (progress.wasCanceled()) {
+			break;
+		}
+
+		qint64 data_size = 0;
+		const QFuture<void> write = exportDiagram(diagram_line, &data_size);
+		progress.setValue(++done);
+
+		if (!write.isCanceled()) {
+			pending_writes << qMakePair(write, data_size);
+			pending_bytes += data_size;
+		} else {
+				//Nothing to write
+			progress.setValue(++done);
+		}
+		updateWrites(max_pending_bytes);
+	}
+
+	const bool canceled = progress.wasCanceled();
+	updateWrites(-1);
+	return !canceled;
+}
+
 /**
 	Exporte un schema
+	The diagram is rendered immediately, the SVG and image files
+	are encoded and written in the global thread pool.
 	@param diagram_line La ligne decrivant le schema a exporter et la maniere
 	de l'exporter
+	@param data_size : if not null, set to the size in bytes of the
+	rendered diagram kept until the file is written
+	@return the writing of the file, a canceled future if the file
+	is already written or can't be written.
 */
-void ExportDialog::exportDiagram(ExportDiagramLine *diagram_line) {
+QFuture<void> ExportDialog::exportDiagram(ExportDiagramLine *diagram_line,
+					   qint64 *data_size) {
 	ExportProperties export_properties(epw -> exportProperties());
 	
 	// recupere le format a utiliser (acronyme et extension)
@@ -796,38 +925,76 @@ void ExportDialog::exportDiagram(ExportDiagramLine *diagram_line) {
 			).arg(diagram_path),
 			QMessageBox::Ok
 		);
-		return;
+		return QFuture<void>();
 	}
 	
-	// ouvre le fichier
-	QFile target_file(diagram_path);
+	const int width  = diagram_line -> width  -> value();
+	const int height = diagram_line -> height -> value();
 	
 	// enregistre l'image dans le fichier
 	if (format_acronym == "SVG") {
-		generateSvg(
+		const QPicture picture = generateSvgPicture(
 			diagram_line -> diagram,
-			diagram_line -> width  -> value(),
-			diagram_line -> height -> value(),
+			width,
+			height,
 			diagram_line -> keep_ratio -> isChecked(),
-			target_file
+			export_properties
 		);
+		if (data_size) {
+			*data_size = picture.size();
+		}
+		return QtConcurrent::run([picture, width, height, diagram_path]()
+		{
+			QFile target_file(diagram_path);
+			writeSvg(picture, width, height, target_file);
+			target_file.close();
+		});
 	} else if (format_acronym == "DXF") {
-		generateDxf(
+			//generateDxf read the items of the diagram while it write
+			//the file, the dxf files are written in the gui thread.
+		if (!generateDxf(
 			diagram_line -> diagram,
-			diagram_line -> width  -> value(),
-			diagram_line -> height -> value(),
-			diagram_path
-		);
+			width,
+			height,
+			diagram_path,
+			export_properties
+		)) {
+			QET::QetMessageBox::critical(
+				this,
+				tr("Impossible d'écrire dans ce fichier", "message box title"),
+				QString(
+					tr(
+						"Le fichier %1 n'a pas pu être écrit.",
+						"message box content"
+					)
+				).arg(diagram_path),
+				QMessageBox::Ok
+			);
+		}
+		return QFuture<void>();
 	} else {
-		QImage image = generateImage(
+		const QImage image = generateImage(
 			diagram_line -> diagram,
-			diagram_line -> width  -> value(),
-			diagram_line -> height -> value(),
-			diagram_line -> keep_ratio -> isChecked()
+			width,
+			height,
+			diagram_line -> keep_ratio -> isChecked(),
+			export_properties
 		);
-		image.save(&target_file, format_acronym.toUtf8().data());
+		if (data_size) {
+#if QT_VERSION < QT_VERSION_CHECK(5, 10, 0) // ### Qt 6: remove
+			*data_size = image.byteCount();
+#else
+			*data_size = image.sizeInBytes();
+#endif
+		}
+		const QByteArray format = format_acronym.toUtf8();
+		return QtConcurrent::run([image, format, diagram_path]()
+		{
+			QFile target_file(diagram_path);
+			image.save(&target_file, format.data());
+			target_file.close();
+		});
 	}
-	target_file.close();
 }
 
 /**
@@ -925,7 +1092,8 @@ void ExportDialog::slot_previewDiagram(int diagram_id) {
 		current_diagram -> diagram,
 		current_diagram -> width  -> value(),
 		current_diagram -> height -> value(),
-		current_diagram -> keep_ratio -> isChecked()
+		current_diagram -> keep_ratio -> isChecked(),
+		epw -> exportProperties()
 	);
 	
 	// nettoie l'apercu
@@ -967,7 +1135,8 @@ void ExportDialog::slot_exportToClipBoard(int diagram_id) {
 			diagram_line -> width  -> value(),
 			diagram_line -> height -> value(),
 			diagram_line -> keep_ratio -> isChecked(),
-			buffer
+			buffer,
+			epw -> exportProperties()
 		);
 		buffer.close();
 		clipboard -> setText(ba);
@@ -976,12 +1145,26 @@ void ExportDialog::slot_exportToClipBoard(int diagram_id) {
 			diagram_line -> diagram,
 			diagram_line -> width  -> value(),
 			diagram_line -> height -> value(),
-			diagram_line -> keep_ratio -> isChecked()
+			diagram_line -> keep_ratio -> isChecked(),
+			epw -> exportProperties()
 		);
 		clipboard -> setImage(image);
 	}
 }
 
+/**
+	@param diagram
+	@return the default file name, without extension,
+	used to export diagram
+*/
+QString ExportDialog::diagramFileName(Diagram *diagram)
+{
+	QString diagram_index = QString::number(diagram -> folioIndex()+1);
+	QString diagram_filename = diagram -> title();
+	if (diagram_filename.isEmpty()) diagram_filename = QObject::tr("schema");
+	return(QET::stringToFileName(diagram_index + "_" + diagram_filename));
+}
+
 /**
 	Constructeur
 	@param dia Schema concerne, 
@@ -994,12 +1177,9 @@ ExportDialog::ExportDiagramLine::ExportDiagramLine(Diagram *dia, QSize diagram_s
 	
 	// titre et nom de fichier du schema
 	QString diagram_title = diagram -> title();
-	QString diagram_index = QString::number(diagram -> folioIndex()+1);
 	//QString diagram_folio_label = diagram -> border_and_titleblock.finalfolio();
 	if (diagram_title.isEmpty()) diagram_title = QObject::tr("Folio sans titre");
-	QString diagram_filename = diagram -> title();
-	if (diagram_filename.isEmpty()) diagram_filename = QObject::tr("schema");
-	diagram_filename = QET::stringToFileName(diagram_index + "_" + diagram_filename);
+	QString diagram_filename = ExportDialog::diagramFileName(diagram);
 	
 	title_label = new QLabel(diagram_title);
 	
@@ -17,6 +17,7 @@
 */
 #ifndef EXPORTDIALOG_H
 #define EXPORTDIALOG_H
+#include <QFuture>
 #include <QtWidgets>
 #include "diagram.h"
 #include "qetproject.h"
@@ -38,6 +39,13 @@ class ExportDialog : public QDialog {
 	// methods
 	int diagramsToExportCount() const;
 	static QPointF rotation_transformed(qreal, qreal, qreal, qreal, qreal);
+	static QString diagramFileName(Diagram *);
+	static QSize diagramSize(Diagram *, const ExportProperties &);
+	static void generateSvg(Diagram *, int, int, bool, QIODevice &, const ExportProperties &);
+	static QPicture generateSvgPicture(Diagram *, int, int, bool, const ExportProperties &);
+	static void writeSvg(const QPicture &, int, int, QIODevice &);
+	static bool generateDxf(Diagram *, int, int, QString &, const ExportProperties &);
+	static QImage generateImage(Diagram *, int, int, bool, const ExportProperties &);
 
 	private:
 	ExportDialog(const ExportDialog &);
@@ -84,11 +92,8 @@ class ExportDialog : public QDialog {
 	
 	// methods
 	QWidget *initDiagramsListPart();
-	void saveReloadDiagramParameters(Diagram *, bool = true);
-	void generateSvg(Diagram *, int, int, bool, QIODevice &);
-	void generateDxf(Diagram *, int, int, QString &);
-	QImage generateImage(Diagram *, int, int, bool);
-	void exportDiagram(ExportDiagramLine *);
+	bool exportDiagrams(const QList<ExportDiagramLine *> &);
+	QFuture<void> exportDiagram(ExportDiagramLine *, qint64 * = nullptr);
 	qreal diagramRatio(Diagram *);
 	QSize diagramSize(Diagram *);
 	
@@ -0,0 +1,238 @@
+/*
+	Copyright 2006-2024 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "elementdefinitioncache.h"
+
+#include "../ElementsCollection/elementslocation.h"
+#include "../ElementsCollection/xmlelementcollection.h"
+#include "../qetproject.h"
+
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutexLocker>
+
+ElementDefinitionCache* ElementDefinitionCache::m_cache = nullptr;
+
+/**
+	@brief ElementDefinitionCache::definition
+	@param location
+	@return the xml definition (tag name "definition")
+	of the element at location, or a null QDomElement
+	if the location can't be read.
+	The returned element is shared and must not be modified.
+*/
+QDomElement ElementDefinitionCache::definition(const ElementsLocation &location)
+{
+	return fetch(location).m_document.documentElement();
+}
+
+/**
+	@brief ElementDefinitionCache::linkType
+	@param location
+	@return the value of the attribute "link_type"
+	of the definition at location, or an empty string.
+*/
+QString ElementDefinitionCache::linkType(const ElementsLocation &location)
+{
+	return fetch(location).m_link_type;
+}
+
+/**
+	@brief ElementDefinitionCache::removeProject
+	Remove all definitions of the embedded collection of project.
+	Must be called when project is deleted.
+	@param project
+*/
+void ElementDefinitionCache::removeProject(QETProject *project)
+{
+	QMutexLocker locker(&m_mutex);
+	m_project_definitions.remove(project);
+}
+
+/**
+	@brief ElementDefinitionCache::clear
+	Remove all definitions and reset the counters
+*/
+void ElementDefinitionCache::clear()
+{
+	QMutexLocker locker(&m_mutex);
+	m_file_definitions.clear();
+	m_project_definitions.clear();
+	m_hits = 0;
+	m_misses = 0;
+}
+
+/**
+	@brief ElementDefinitionCache::hits
+	@return the number of definitions served from the cache
+*/
+int ElementDefinitionCache::hits() const
+{
+	QMutexLocker locker(&m_mutex);
+	return m_hits;
+}
+
+/**
+	@brief ElementDefinitionCache::misses
+	@return the number of definitions which needed to be parsed
+*/
+int ElementDefinitionCache::misses() const
+{
+	QMutexLocker locker(&m_mutex);
+	return m_misses;
+}
+
+/**
+	@brief ElementDefinitionCache::fetch
+	Return the cached definition of location,
+	read and store it first if needed.
+	The parsing is done without holding the lock,
+	so several definitions can be parsed at the same time.
+	@param location
+	@return
+*/
+ElementDefinitionCache::Definition ElementDefinitionCache::fetch(
+		const ElementsLocation &location)
+{
+	if (!location.isElement()) {
+		return Definition();
+	}
+
+	if (QETProject *project = location.project())
+	{
+		XmlElementCollection *collection = project->embeddedElementCollection();
+		if (!collection) {
+			return Definition();
+		}
+
+		const QString path = location.collectionPath(false);
+		const quint64 revision = collection->revision();
+		{
+			QMutexLocker locker(&m_mutex);
+			ProjectDefinitions &pd = m_project_definitions[project];
+			if (pd.m_revision != revision)
+			{
+				pd.m_revision = revision;
+				pd.m_definitions.clear();
+			}
+			else if (pd.m_definitions.contains(path))
+			{
+				++m_hits;
+				return pd.m_definitions.value(path);
+			}
+		}
+
+		Definition def = parse(collection->element(path)
+				       .firstChildElement(QStringLiteral("definition")));
+
+		QMutexLocker locker(&m_mutex);
+		++m_misses;
+		ProjectDefinitions &pd = m_project_definitions[project];
+		if (pd.m_revision == revision) {
+			pd.m_definitions.insert(path, def);
+		}
+		return def;
+	}
+
+	const QString file_path = location.fileSystemPath();
+	const QFileInfo file_info(file_path);
+	if (!file_info.exists()) {
+		return Definition();
+	}
+
+	const qint64 mtime = file_info.lastModified().toMSecsSinceEpoch();
+	const qint64 size = file_info.size();
+	const QString key = location.collectionPath();
+	{
+		QMutexLocker locker(&m_mutex);
+		auto it = m_file_definitions.constFind(key);
+		if (it != m_file_definitions.constEnd()
+			&& it->m_mtime == mtime
+			&& it->m_size == size)
+		{
+			++m_hits;
+			return it.value();
+		}
+	}
+
+	QFile file(file_path);
+	QDomDocument document;
+	if (!document.setContent(&file)) {
+		return Definition();
+	}
+
+	Definition def = parse(document.documentElement());
+	def.m_mtime = mtime;
+	def.m_size = size;
+
+	QMutexLocker locker(&m_mutex);
+	++m_misses;
+	m_file_definitions.insert(key, def);
+	return def;
+}
+
+/**
+	@brief ElementDefinitionCache::parse
+	Build a new definition from xml_definition.
+	The xml is copied into a document owned by the cache,
+	and normalized once (see Element::buildFromXml)
+	so it is never modified after being shared.
+	@param xml_definition
+	@return
+*/
+ElementDefinitionCache::Definition ElementDefinitionCache::parse(
+		const QDomElement &xml_definition)
+{
+	Definition def;
+	if (xml_definition.isNull()) {
+		return def;
+	}
+
+	if (xml_definition.ownerDocument().documentElement() == xml_definition) {
+		def.m_document = xml_definition.ownerDocument();
+	} else {
+		def.m_document.appendChild(def.m_document.importNode(xml_definition, true));
+	}
+
+	QDomElement root = def.m_document.documentElement();
+	def.m_link_type = root.attribute(QStringLiteral("link_type"));
+
+		//If there is no input with tagg "label", the first input become the label
+	const QDomElement description = root.firstChildElement(QStringLiteral("description"));
+	QDomElement first_input;
+	bool have_label = false;
+	for (QDomElement input = description.firstChildElement(QStringLiteral("input")) ;
+		 !input.isNull() ;
+		 input = input.nextSiblingElement(QStringLiteral("input")))
+	{
+		if (first_input.isNull()) {
+			first_input = input;
+		}
+		if (input.attribute(QStringLiteral("tagg"), QStringLiteral("none"))
+				== QLatin1String("label"))
+		{
+			have_label = true;
+			break;
+		}
+	}
+	if (!have_label && !first_input.isNull()) {
+		first_input.setAttribute(QStringLiteral("tagg"), QStringLiteral("label"));
+	}
+
+	return def;
+}
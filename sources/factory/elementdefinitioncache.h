@@ -0,0 +1,117 @@
+/*
+	Copyright 2006-2024 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef ELEMENTDEFINITIONCACHE_H
+#define ELEMENTDEFINITIONCACHE_H
+
+#include <QDomElement>
+#include <QHash>
+#include <QMutex>
+
+class ElementsLocation;
+class QETProject;
+
+/**
+	@brief The ElementDefinitionCache class
+	This class is a singleton which keep in memory
+	one parsed definition per element type.
+	Definitions of the file system collections are keyed
+	by collection path and are re-read when the modification time
+	or the size of the file change.
+	Definitions of the embedded collection of a project are keyed by
+	project and collection path and are dropped each time
+	the revision of the embedded collection change.
+	The returned definitions are shared between all instances of an element
+	and must be considered as read only.
+*/
+class ElementDefinitionCache
+{
+	public:
+		/**
+			@brief instance
+			@return The instance of the cache
+		*/
+		static ElementDefinitionCache* instance()
+		{
+			static QMutex mutex;
+			if (!m_cache)
+			{
+				mutex.lock();
+				if (!m_cache) {
+					m_cache = new ElementDefinitionCache();
+				}
+				mutex.unlock();
+			}
+			return m_cache;
+		}
+
+		/**
+			@brief dropInstance
+			Drop the instance of the cache
+		*/
+		static void dropInstance()
+		{
+			static QMutex mutex;
+			if (m_cache)
+			{
+				mutex.lock();
+				delete m_cache;
+				m_cache = nullptr;
+				mutex.unlock();
+			}
+		}
+
+		QDomElement definition(const ElementsLocation &location);
+		QString linkType(const ElementsLocation &location);
+		void removeProject(QETProject *project);
+		void clear();
+
+		int hits() const;
+		int misses() const;
+
+	private:
+		struct Definition
+		{
+			QDomDocument m_document;
+			QString m_link_type;
+			qint64 m_mtime = 0;
+			qint64 m_size = 0;
+		};
+
+		struct ProjectDefinitions
+		{
+			quint64 m_revision = 0;
+			QHash<QString, Definition> m_definitions;
+		};
+
+		ElementDefinitionCache() {}
+		ElementDefinitionCache (const ElementDefinitionCache &);
+		ElementDefinitionCache operator= (const ElementDefinitionCache &);
+		~ElementDefinitionCache() {}
+
+		Definition fetch(const ElementsLocation &location);
+		static Definition parse(const QDomElement &xml_definition);
+
+		QHash<QString, Definition> m_file_definitions;
+		QHash<QETProject *, ProjectDefinitions> m_project_definitions;
+		mutable QMutex m_mutex;
+		int m_hits = 0;
+		int m_misses = 0;
+		static ElementDefinitionCache* m_cache;
+};
+
+#endif // ELEMENTDEFINITIONCACHE_H
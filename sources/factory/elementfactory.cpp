@@ -16,6 +16,7 @@
 	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include "elementfactory.h"
+#include "elementdefinitioncache.h"
 
 #include "../qetgraphicsitem/masterelement.h"
 #include "../qetgraphicsitem/reportelement.h"
@@ -42,10 +43,9 @@ Element * ElementFactory::createElement(const ElementsLocation &location, QGraph
 		return nullptr;
 	}
 
-	auto doc = location.pugiXml();
-	if (doc.document_element().attribute("link_type"))
+	const QString link_type = ElementDefinitionCache::instance()->linkType(location);
+	if (!link_type.isEmpty())
 	{
-		QString link_type(doc.document_element().attribute("link_type").as_string());
 		if (link_type == QLatin1String("next_report") || link_type == QLatin1String("previous_report"))
 			return (new ReportElement(location, link_type, qgi, state));
 		if (link_type == QLatin1String("master"))
@@ -29,10 +29,25 @@
 #include <QPicture>
 #include <QRegularExpression>
 #include <QTextDocument>
+#include <QtDebug>
 #include <iostream>
+#include <limits>
 
 ElementPictureFactory* ElementPictureFactory::m_factory = nullptr;
 
+namespace {
+		///Default memory budget of the factory : 128 MiB
+	const qint64 default_memory_budget = 128 * 1024 * 1024;
+}
+
+/**
+	@brief ElementPictureFactory::ElementPictureFactory
+*/
+ElementPictureFactory::ElementPictureFactory()
+{
+	setMemoryBudget(default_memory_budget);
+}
+
 /**
 	@brief ElementPictureFactory::getPictures
 	Set the picture of the element at location.
@@ -50,22 +65,16 @@ void ElementPictureFactory::getPictures(const ElementsLocation &location, QPictu
 	QUuid uuid = location.uuid();
 	if(Q_UNLIKELY(uuid.isNull()))
 	{
-		build(location, &picture, &low_picture);
+		primitives prim;
+		build(location, picture, low_picture, prim);
 		return;
 	}
 
-	if(m_pictures_H.keys().contains(uuid))
+	QMutexLocker locker(&m_mutex);
+	if (Entry *e = entry(location, uuid))
 	{
-		picture = m_pictures_H.value(uuid);
-		low_picture = m_low_pictures_H.value(uuid);
-	}
-	else
-	{
-		if (build(location))
-		{
-			picture = m_pictures_H.value(uuid);
-			low_picture = m_low_pictures_H.value(uuid);
-		}
+		picture = e->m_picture;
+		low_picture = e->m_low_picture;
 	}
 }
 
@@ -79,77 +88,191 @@ QPixmap ElementPictureFactory::pixmap(const ElementsLocation &location)
 {
 	QUuid uuid = location.uuid();
 
-	if (m_pixmap_H.contains(uuid)) {
-		return m_pixmap_H.value(uuid);
+	if (uuid.isNull())
+	{
+		QPicture picture, low_picture;
+		primitives prim;
+		const bool built = build(location, picture, low_picture, prim);
+		return built ? buildPixmap(location, picture) : QPixmap();
 	}
 
-	if(build(location))
+	QMutexLocker locker(&m_mutex);
+	Entry *e = entry(location, uuid);
+	if (!e) {
+		return QPixmap();
+	}
+
+	if (e->m_pixmap.isNull())
 	{
-		auto doc = location.pugiXml();
-			//size
-		int w = doc.document_element().attribute("width").as_int();
-		int h = doc.document_element().attribute("height").as_int();
-		while (w % 10) ++ w;
-		while (h % 10) ++ h;
-			//hotspot
-		int hsx = qMin(doc.document_element().attribute("hotspot_x").as_int(), w);
-		int hsy = qMin(doc.document_element().attribute("hotspot_y").as_int(), h);
-
-		QPixmap pix(w, h);
-		pix.fill(QColor(255, 255, 255, 0));
-
-		QPainter painter(&pix);
-		painter.setRenderHint(QPainter::Antialiasing, true);
-		painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
-		painter.translate(hsx, hsy);
-		painter.drawPicture(0, 0, m_pictures_H.value(uuid));
-
-		if (!uuid.isNull()) {
-			m_pixmap_H.insert(uuid, pix);
-		}
+		e->m_pixmap = buildPixmap(location, e->m_picture);
+			//The cost of the entry change, insert it again.
+		const QPixmap pix = e->m_pixmap;
+		insert(uuid, m_cache.take(uuid));
 		return pix;
 	}
 
-	return QPixmap();
+	return e->m_pixmap;
 }
 
 
 /**
 	@brief ElementPictureFactory::getPrimitives
 	@param location
-	@return The primtive used to draw the element at location
+	@return The primtive used to draw the element at location.
+	The texts of the primitives are shared with the factory,
+	they stay valid when the entry of the element is removed.
 */
 ElementPictureFactory::primitives ElementPictureFactory::getPrimitives(
 		const ElementsLocation &location)
 {
-	if(!m_primitives_H.contains(location.uuid()))
-		build(location);
+	QMutexLocker locker(&m_mutex);
+	if (Entry *e = entry(location, location.uuid())) {
+		return e->m_primitives;
+	}
 
-	return m_primitives_H.value(location.uuid());
+	return primitives();
+}
+
+/**
+	@brief ElementPictureFactory::setMemoryBudget
+	Set the maximum memory used by the stored pictures, pixmap and primitives.
+	The least recently used entries are removed to stay under the budget.
+	@param bytes : the budget in bytes, 0 for no limit.
+*/
+void ElementPictureFactory::setMemoryBudget(qint64 bytes)
+{
+	QMutexLocker locker(&m_mutex);
+	const int count = m_cache.count();
+	m_cache.setMaxCost(bytes > 0 && bytes < std::numeric_limits<int>::max()
+			   ? int(bytes)
+			   : std::numeric_limits<int>::max());
+	m_statistics.m_evictions += count - m_cache.count();
+}
+
+/**
+	@brief ElementPictureFactory::memoryBudget
+	@return the maximum memory in bytes used by the stored entries
+*/
+qint64 ElementPictureFactory::memoryBudget() const
+{
+	QMutexLocker locker(&m_mutex);
+	return m_cache.maxCost();
+}
+
+/**
+	@brief ElementPictureFactory::statistics
+	@return the number of hits, misses and evictions since the creation
+	of the factory, and the current number of entries and the memory they use.
+*/
+ElementPictureFactory::Statistics ElementPictureFactory::statistics() const
+{
+	QMutexLocker locker(&m_mutex);
+	Statistics statistics = m_statistics;
+	statistics.m_count = m_cache.count();
+	statistics.m_bytes = m_cache.totalCost();
+	return statistics;
+}
+
+/**
+	@brief ElementPictureFactory::clear
+	Remove all the stored entries
+*/
+void ElementPictureFactory::clear()
+{
+	QMutexLocker locker(&m_mutex);
+	m_cache.clear();
 }
 
 ElementPictureFactory::~ElementPictureFactory()
+{}
+
+/**
+	@brief ElementPictureFactory::entry
+	Must be called with m_mutex locked.
+	@param location
+	@param uuid : the uuid of location
+	@return the entry of uuid, build and store it if needed,
+	or nullptr if location can't be built.
+*/
+ElementPictureFactory::Entry *ElementPictureFactory::entry(
+		const ElementsLocation &location, const QUuid &uuid)
 {
-	for (primitives p : m_primitives_H.values()) {
-		qDeleteAll(p.m_texts);
+	if (Entry *e = m_cache.object(uuid))
+	{
+		++m_statistics.m_hits;
+		return e;
+	}
+
+	++m_statistics.m_misses;
+	Entry *e = new Entry();
+	if (!build(location, e->m_picture, e->m_low_picture, e->m_primitives))
+	{
+		delete e;
+		return nullptr;
 	}
+
+	insert(uuid, e);
+	return e;
+}
+
+/**
+	@brief ElementPictureFactory::insert
+	Store entry, the factory take ownership of entry.
+	An entry bigger than the budget is stored alone,
+	so it stays valid until the next call.
+	Must be called with m_mutex locked.
+	@param uuid
+	@param entry
+*/
+void ElementPictureFactory::insert(const QUuid &uuid, Entry *entry)
+{
+	const int count = m_cache.count() + 1;
+	m_cache.insert(uuid, entry, qMin(cost(*entry), int(m_cache.maxCost())));
+	m_statistics.m_evictions += count - m_cache.count();
+}
+
+/**
+	@brief ElementPictureFactory::cost
+	@param entry
+	@return the approximate memory used by entry, in bytes
+*/
+int ElementPictureFactory::cost(const Entry &entry)
+{
+	qint64 bytes = sizeof(Entry);
+	bytes += entry.m_picture.size();
+	bytes += entry.m_low_picture.size();
+	if (!entry.m_pixmap.isNull()) {
+		bytes += qint64(entry.m_pixmap.width()) * entry.m_pixmap.height()
+				* entry.m_pixmap.depth() / 8;
+	}
+
+	const primitives &prim = entry.m_primitives;
+	bytes += prim.m_lines.size() * sizeof(QLineF);
+	bytes += (prim.m_rectangles.size() + prim.m_circles.size()) * sizeof(QRectF);
+	for (const auto &polygon : prim.m_polygons) {
+		bytes += polygon.size() * sizeof(QPointF);
+	}
+	for (const auto &arc : prim.m_arcs) {
+		bytes += arc.size() * sizeof(qreal);
+	}
+	bytes += prim.m_texts.size() * sizeof(QGraphicsSimpleTextItem);
+
+	return int(qMin<qint64>(bytes, std::numeric_limits<int>::max()));
 }
 
 /**
 	@brief ElementPictureFactory::build
 	Build the picture from location.
 	@param location
-	@param picture
-	@param low_picture
-	if picture and/or low_picture are not null
-	this function draw on it and don't store it.
-	if null, this function create a QPicture for normal and low zoom,
-	draw on it and store it in m_pictures_H and m_low_pictures_H
-	@return
+	@param picture : picture to draw on
+	@param low_picture : picture to draw on for low zoom
+	@param prim : primitives of the drawing
+	@return true if the element was built
 */
 bool ElementPictureFactory::build(const ElementsLocation &location,
-				  QPicture *picture,
-				  QPicture *low_picture)
+				  QPicture &picture,
+				  QPicture &low_picture,
+				  primitives &prim) const
 {
 	QDomElement dom = location.xml();
 
@@ -176,27 +299,14 @@ bool ElementPictureFactory::build(const ElementsLocation &location,
 	}
 
 	QPainter painter;
-	QPicture pic;
-	primitives primitives_;
-	if (picture) {
-		painter.begin(picture);
-	}
-	else {
-		painter.begin(&pic);
-	}
+	painter.begin(&picture);
 	painter.setRenderHint(QPainter::Antialiasing,         true);
 	painter.setRenderHint(QPainter::TextAntialiasing,     true);
 	painter.setRenderHint(QPainter::SmoothPixmapTransform,true);
 
 
 	QPainter low_painter;
-	QPicture low_pic;
-	if (low_picture) {
-		low_painter.begin(low_picture);
-	}
-	else {
-		low_painter.begin(&low_pic);
-	}
+	low_painter.begin(&low_picture);
 	low_painter.setRenderHint(QPainter::Antialiasing,         true);
 	low_painter.setRenderHint(QPainter::TextAntialiasing,     true);
 	low_painter.setRenderHint(QPainter::SmoothPixmapTransform,true);
@@ -223,7 +333,7 @@ bool ElementPictureFactory::build(const ElementsLocation &location,
 				if (qde.isNull()) {
 					continue;
 				}
-				parseElement(qde, painter, primitives_);
+				parseElement(qde, painter, prim);
 				primitives fake_prim;
 				parseElement(qde, low_painter, fake_prim);
 			}
@@ -234,19 +344,40 @@ bool ElementPictureFactory::build(const ElementsLocation &location,
 	painter.end();
 	low_painter.end();
 
-	const auto uuid_ = location.uuid();
-	if (!picture) {
-		m_pictures_H.insert(uuid_, pic);
-		m_primitives_H.insert(uuid_, primitives_);
-	}
-	if (!low_picture) {
-		m_low_pictures_H.insert(uuid_, low_pic);
-		m_primitives_H.insert(uuid_, primitives_);
-	}
-
 	return true;
 }
 
+/**
+	@brief ElementPictureFactory::buildPixmap
+	@param location
+	@param picture : the picture of the element at location
+	@return the pixmap of the element at location
+*/
+QPixmap ElementPictureFactory::buildPixmap(const ElementsLocation &location,
+					   const QPicture &picture) const
+{
+	auto doc = location.pugiXml();
+		//size
+	int w = doc.document_element().attribute("width").as_int();
+	int h = doc.document_element().attribute("height").as_int();
+	while (w % 10) ++ w;
+	while (h % 10) ++ h;
+		//hotspot
+	int hsx = qMin(doc.document_element().attribute("hotspot_x").as_int(), w);
+	int hsy = qMin(doc.document_element().attribute("hotspot_y").as_int(), h);
+
+	QPixmap pix(w, h);
+	pix.fill(QColor(255, 255, 255, 0));
+
+	QPainter painter(&pix);
+	painter.setRenderHint(QPainter::Antialiasing, true);
+	painter.setRenderHint(QPainter::SmoothPixmapTransform, true);
+	painter.translate(hsx, hsy);
+	painter.drawPicture(0, 0, picture);
+
+	return pix;
+}
+
 void ElementPictureFactory::parseElement(const QDomElement &dom, QPainter &painter, primitives &prim) const
 {
 		 if (dom.tagName() == "line")    (parseLine   (dom, painter, prim));
@@ -538,7 +669,7 @@ void ElementPictureFactory::parseText(const QDomElement &dom, QPainter &painter,
 	text_document.documentLayout() -> draw(&painter, ctx);
 
 		//A very dirty workaround for export this text to dxf
-	QGraphicsSimpleTextItem *qgsti = new QGraphicsSimpleTextItem();
+	QSharedPointer<QGraphicsSimpleTextItem> qgsti(new QGraphicsSimpleTextItem());
 	qgsti->setText(dom.attribute("text"));
 	qgsti->setFont(font_);
 	qgsti->setPos(dom.attribute("x").toDouble(), dom.attribute("y").toDouble());
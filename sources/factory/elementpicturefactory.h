@@ -18,13 +18,14 @@
 #ifndef ELEMENTPICTUREFACTORY_H
 #define ELEMENTPICTUREFACTORY_H
 
+#include <QCache>
 #include <QMutex>
+#include <QPicture>
+#include <QPixmap>
 #include <QSharedPointer>
-#include <QHash>
+#include <QUuid>
 
 class ElementsLocation;
-class QPicture;
-class QUuid;
 class QDomElement;
 class QPainter;
 class QGraphicsSimpleTextItem;
@@ -32,7 +33,10 @@ class QGraphicsSimpleTextItem;
 /**
 	@brief The ElementPictureFactory class
 	This class is singleton factory, use
-	to create and get the picture use by elements
+	to create and get the picture use by elements.
+	The pictures, pixmap and primitives of an element are stored
+	in one entry per uuid. When the memory budget is reached,
+	the least recently used entries are removed.
 */
 class ElementPictureFactory
 {
@@ -44,7 +48,18 @@ class ElementPictureFactory
 			QList<QRectF> m_circles;
 			QList<QVector<QPointF>> m_polygons;
 			QList<QVector<qreal>> m_arcs;
-			QList<QGraphicsSimpleTextItem*> m_texts;
+				//Shared with the cache, the texts stay valid
+				//after the entry is removed
+			QList<QSharedPointer<QGraphicsSimpleTextItem>> m_texts;
+		};
+
+		struct Statistics
+		{
+			int m_hits = 0;
+			int m_misses = 0;
+			int m_evictions = 0;
+			int m_count = 0;
+			qint64 m_bytes = 0;
 		};
 		
 		
@@ -85,14 +100,31 @@ class ElementPictureFactory
 		void getPictures(const ElementsLocation &location, QPicture &picture, QPicture &low_picture);
 		QPixmap pixmap(const ElementsLocation &location);
 		ElementPictureFactory::primitives getPrimitives(const ElementsLocation &location);
+
+		void setMemoryBudget(qint64 bytes);
+		qint64 memoryBudget() const;
+		Statistics statistics() const;
+		void clear();
 		
 	private:
-		ElementPictureFactory() {}
+		struct Entry
+		{
+			QPicture m_picture;
+			QPicture m_low_picture;
+			QPixmap m_pixmap;
+			primitives m_primitives;
+		};
+
+		ElementPictureFactory();
 		ElementPictureFactory (const ElementPictureFactory &);
 		ElementPictureFactory operator= (const ElementPictureFactory &);
 		~ElementPictureFactory();
 		
-		bool build(const ElementsLocation &location, QPicture *picture=nullptr, QPicture *low_picture=nullptr);
+		Entry *entry(const ElementsLocation &location, const QUuid &uuid);
+		void insert(const QUuid &uuid, Entry *entry);
+		static int cost(const Entry &entry);
+		bool build(const ElementsLocation &location, QPicture &picture, QPicture &low_picture, primitives &prim) const;
+		QPixmap buildPixmap(const ElementsLocation &location, const QPicture &picture) const;
 		void parseElement(const QDomElement &dom, QPainter &painter, primitives &prim) const;
 		void parseLine   (const QDomElement &dom, QPainter &painter, primitives &prim) const;
 		void parseRect   (const QDomElement &dom, QPainter &painter, primitives &prim) const;
@@ -103,10 +135,9 @@ class ElementPictureFactory
 		void parseText   (const QDomElement &dom, QPainter &painter, primitives &prim) const;
 		void setPainterStyle(const QDomElement &dom, QPainter &painter) const;
 		
-		QHash<QUuid, QPicture> m_pictures_H;
-		QHash<QUuid, QPicture> m_low_pictures_H;
-		QHash<QUuid, QPixmap> m_pixmap_H;
-		QHash<QUuid, primitives> m_primitives_H;
+		QCache<QUuid, Entry> m_cache;
+		mutable QMutex m_mutex;
+		Statistics m_statistics;
 		static ElementPictureFactory* m_factory;
 };
 
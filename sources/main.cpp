@@ -16,6 +16,7 @@
 	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include "machine_info.h"
+#include "projectbatchexporter.h"
 #include "qet.h"
 #include "qetapp.h"
 #include "singleapplication.h"
@@ -189,6 +190,23 @@ QGuiApplication::setHighDpiScaleFactorRoundingPolicy(QetSettings::hdpiScaleFacto
 #endif
 
 
+	//Batch export from the command line : no window and no single
+	//instance, so several exports can run at the same time.
+	if (ProjectBatchExporter::requested(argc, argv))
+	{
+		if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM")) {
+			qputenv("QT_QPA_PLATFORM", "offscreen");
+		}
+		QApplication app(argc, argv);
+		QStringList arg_list = app.arguments();
+		//Remove the first argument, it's the binary file
+		arg_list.takeFirst();
+
+		QETApp qetapp;
+		ProjectBatchExporter exporter(QETArguments{arg_list});
+		return exporter.exec();
+	}
+
 	SingleApplication app(argc, argv, true);
 #ifdef Q_OS_MACOS
 	//Handle the opening of QET when user double click on a .qet .elmt .tbt file
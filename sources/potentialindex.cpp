@@ -0,0 +1,238 @@
+/*
+	Copyright 2006-2024 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "potentialindex.h"
+
+#include "diagram.h"
+#include "qetgraphicsitem/conductor.h"
+#include "qetgraphicsitem/element.h"
+#include "qetgraphicsitem/terminal.h"
+#include "qetproject.h"
+
+/**
+	@brief PotentialIndex::PotentialIndex
+	@param project : the project to index
+*/
+PotentialIndex::PotentialIndex(QETProject *project) :
+	m_project(project)
+{}
+
+/**
+	@brief PotentialIndex::conductors
+	@param conductor
+	@param all_diagram : if true search in all diagram of the project,
+	false search only in the parent diagram of conductor
+	@return all conductors at the same potential of conductor,
+	conductor isn't part of the returned QSet.
+*/
+QSet<Conductor *> PotentialIndex::conductors(const Conductor *conductor,
+					     bool all_diagram)
+{
+	if (!m_valid) {
+		build();
+	}
+
+	PotentialPartition<Terminal, Conductor> &partition =
+			all_diagram ? m_project_partition : m_diagram_partition;
+
+		//A terminal which is not in a diagram of the project
+		//(conductor being created) is not indexed, search by hand.
+	if (!partition.contains(conductor->terminal1)
+		|| !partition.contains(conductor->terminal2)) {
+		return search(conductor, all_diagram);
+	}
+
+	return partition.conductors(conductor);
+}
+
+/**
+	@brief PotentialIndex::conductorAdded
+	Merge the two potentials linked by conductor.
+	If a terminal of conductor is unknown the index is invalidated.
+	@param conductor
+*/
+void PotentialIndex::conductorAdded(Conductor *conductor)
+{
+	if (!m_valid) {
+		return;
+	}
+
+	if (!m_project_partition.addConductor(conductor)
+		|| !m_diagram_partition.addConductor(conductor)) {
+		invalidate();
+	}
+}
+
+/**
+	@brief PotentialIndex::conductorRemoved
+	Split the potential of conductor,
+	conductor must be already removed from one of its terminals.
+	@param conductor
+*/
+void PotentialIndex::conductorRemoved(Conductor *conductor)
+{
+	if (!m_valid) {
+		return;
+	}
+
+	m_project_partition.removeConductor(conductor);
+	m_diagram_partition.removeConductor(conductor);
+}
+
+/**
+	@brief PotentialIndex::elementAdded
+	Add the terminals of element to the index
+	@param element
+*/
+void PotentialIndex::elementAdded(Element *element)
+{
+	if (!m_valid) {
+		return;
+	}
+
+	m_project_partition.addTerminals(element->terminals());
+	m_diagram_partition.addTerminals(element->terminals());
+}
+
+/**
+	@brief PotentialIndex::elementRemoved
+	Remove the terminals of element from the index
+	and split their potentials.
+	@param element
+*/
+void PotentialIndex::elementRemoved(Element *element)
+{
+	if (!m_valid) {
+		return;
+	}
+
+	m_project_partition.removeTerminals(element->terminals());
+	m_diagram_partition.removeTerminals(element->terminals());
+}
+
+/**
+	@brief PotentialIndex::linksChanged
+	Walk again the potentials of the terminals of element,
+	call it when the elements linked to element (folio reports) changed.
+	@param element
+*/
+void PotentialIndex::linksChanged(Element *element)
+{
+	if (!m_valid) {
+		return;
+	}
+
+	m_project_partition.relationsChanged(element->terminals());
+}
+
+/**
+	@brief PotentialIndex::invalidate
+	Drop the index, it will be rebuilt at the next request
+*/
+void PotentialIndex::invalidate()
+{
+	if (!m_valid) {
+		return;
+	}
+
+	m_valid = false;
+	m_project_partition.clear();
+	m_diagram_partition.clear();
+}
+
+/**
+	@brief PotentialIndex::indexOf
+	@param terminal
+	@return the potential index of the project of terminal
+	or nullptr if terminal isn't in a diagram of a project.
+*/
+PotentialIndex *PotentialIndex::indexOf(const Terminal *terminal)
+{
+	if (!terminal) {
+		return nullptr;
+	}
+
+	Diagram *diagram = terminal->diagram();
+	if (!diagram || !diagram->project()) {
+		return nullptr;
+	}
+
+	return diagram->project()->potentialIndex();
+}
+
+/**
+	@brief PotentialIndex::search
+	Walk through the terminals linked to conductor
+	without using an index, used for the conductors
+	which are not in a diagram of a project.
+	@param conductor
+	@param all_diagram
+	@return all conductors at the same potential of conductor,
+	conductor isn't part of the returned QSet.
+*/
+QSet<Conductor *> PotentialIndex::search(const Conductor *conductor,
+					 bool all_diagram)
+{
+	QSet<Conductor *> conductors;
+	QSet<Terminal *> visited;
+	QVector<Terminal *> to_visit{conductor->terminal1, conductor->terminal2};
+
+	while (!to_visit.isEmpty())
+	{
+		Terminal *terminal = to_visit.takeLast();
+		if (visited.contains(terminal)) {
+			continue;
+		}
+		visited.insert(terminal);
+
+		for (Terminal *t : relatedPotentialTerminal(terminal, all_diagram)) {
+			to_visit.append(t);
+		}
+		for (Conductor *c : terminal->conductors())
+		{
+			conductors.insert(c);
+			to_visit << c->terminal1 << c->terminal2;
+		}
+	}
+
+	conductors.remove(const_cast<Conductor *>(conductor));
+	return conductors;
+}
+
+/**
+	@brief PotentialIndex::build
+	Build the two partitions from the diagrams of the project
+*/
+void PotentialIndex::build()
+{
+	m_project_partition.clear();
+	m_diagram_partition.clear();
+	m_valid = true;
+
+	if (!m_project) {
+		return;
+	}
+
+	QList<Terminal *> terminals;
+	for (Diagram *diagram : m_project->diagrams()) {
+		for (Element *element : diagram->elements()) {
+			terminals += element->terminals();
+		}
+	}
+	m_project_partition.addTerminals(terminals);
+	m_diagram_partition.addTerminals(terminals);
+}
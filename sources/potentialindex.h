@@ -0,0 +1,73 @@
+/*
+	Copyright 2006-2024 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef POTENTIALINDEX_H
+#define POTENTIALINDEX_H
+
+#include "utils/potentialpartition.h"
+
+#include <QSet>
+
+class Conductor;
+class Element;
+class QETProject;
+class Terminal;
+
+/**
+	@brief The PotentialIndex class
+	Index of the potentials of a project.
+	Terminals are grouped in disjoint sets (union-find),
+	two terminals are in the same set when they are linked by a conductor,
+	when they belong to the same terminal element
+	or when they belong to two linked folio reports.
+	Two partitions are kept : one which follow the folio reports
+	(potential in all the project) and one which doesn't
+	(potential in one folio).
+
+	Adding an element or a conductor is merged into the index.
+	Removing an element or a conductor or changing a link between reports
+	walk again only the terminals of the potentials which contained them.
+	The whole index is built at the first request.
+*/
+class PotentialIndex
+{
+	public:
+		PotentialIndex(QETProject *project);
+
+		QSet<Conductor *> conductors(const Conductor *conductor,
+					     bool all_diagram = true);
+		void conductorAdded(Conductor *conductor);
+		void conductorRemoved(Conductor *conductor);
+		void elementAdded(Element *element);
+		void elementRemoved(Element *element);
+		void linksChanged(Element *element);
+		void invalidate();
+
+		static PotentialIndex *indexOf(const Terminal *terminal);
+		static QSet<Conductor *> search(const Conductor *conductor,
+						bool all_diagram = true);
+
+	private:
+		void build();
+
+		QETProject *m_project = nullptr;
+		bool m_valid = false;
+		PotentialPartition<Terminal, Conductor> m_project_partition{true};
+		PotentialPartition<Terminal, Conductor> m_diagram_partition{false};
+};
+
+#endif // POTENTIALINDEX_H
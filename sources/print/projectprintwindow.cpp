@@ -31,12 +31,15 @@
 #		pragma message("@TODO remove code for QT 6 or later")
 #	endif
 #endif
+#include <QGraphicsView>
 #include <QMarginsF>
 #include <QPageSetupDialog>
 #include <QPainter>
 #include <QPrintDialog>
 #include <QPrintPreviewWidget>
 #include <QScreen>
+#include <QScrollBar>
+#include <QUndoStack>
 
 /**
  * @brief ProjectPrintWindow::ProjectPrintWindow
@@ -133,6 +136,21 @@ ProjectPrintWindow::ProjectPrintWindow(QETProject *project, QPrinter *printer, Q
 	connect(m_preview, &QPrintPreviewWidget::paintRequested, this, &ProjectPrintWindow::requestPaint);
 	ui->m_vertical_layout->addWidget(m_preview);
 
+		//Render the blank pages of the preview when they are scrolled into view
+	m_visible_pages_timer.setSingleShot(true);
+	m_visible_pages_timer.setInterval(100);
+	connect(&m_visible_pages_timer, &QTimer::timeout, this, &ProjectPrintWindow::renderVisiblePages);
+	if (auto view = m_preview->findChild<QGraphicsView *>())
+	{
+		for (auto scroll_bar : {view->horizontalScrollBar(), view->verticalScrollBar()}) {
+			connect(scroll_bar, &QScrollBar::valueChanged, this, [this]() {
+				if (!m_placeholder_pages.isEmpty()) {
+					m_visible_pages_timer.start();
+				}
+			});
+		}
+	}
+
 	setUpDiagramList();
 
 	if (m_printer->outputFormat() == QPrinter::NativeFormat) //Print to physical printer
@@ -172,6 +190,20 @@ ProjectPrintWindow::ProjectPrintWindow(QETProject *project, QPrinter *printer, Q
 
 	m_backup_diagram_background_color = Diagram::background_color;
 	Diagram::background_color = Qt::white;
+
+		//Any modification of the project can change the rendered pages
+	connect(m_project->undoStack(), &QUndoStack::indexChanged,
+		this, &ProjectPrintWindow::clearPagesCache);
+	connect(m_project, &QETProject::projectInformationsChanged,
+		this, &ProjectPrintWindow::clearPagesCache);
+	connect(m_project, &QETProject::defaultTitleBlockPropertiesChanged,
+		this, &ProjectPrintWindow::clearPagesCache);
+	connect(m_project, &QETProject::diagramAdded,
+		this, &ProjectPrintWindow::clearPagesCache);
+	connect(m_project, &QETProject::diagramRemoved,
+		this, &ProjectPrintWindow::clearPagesCache);
+	connect(m_project, &QETProject::projectDiagramsOrderChanged,
+		this, &ProjectPrintWindow::clearPagesCache);
 }
 
 /**
@@ -187,6 +219,9 @@ ProjectPrintWindow::~ProjectPrintWindow()
 /**
  * @brief ProjectPrintWindow::requestPaint
  * @param slot called when m_preview emit paintRequested
+ * For the preview, only the diagrams with a visible page are rendered,
+ * the pages of the other diagrams are left blank until they are visible.
+ * When printing, every diagram is rendered.
  */
 void ProjectPrintWindow::requestPaint()
 {
@@ -214,24 +249,88 @@ void ProjectPrintWindow::requestPaint()
 		return;
 	}
 
+	const auto fit_page = ui->m_fit_in_page_cb->isChecked();
+	const auto key = pagesCacheKey(fit_page, m_printer);
+	const auto visible_pages = visiblePreviewPages();
+		//If the pages of the preview can't be found, every page is rendered
+	const auto render_all = m_render_all_pages || !previewView();
+	m_placeholder_pages.clear();
+
+	auto page_index = 0;
 	bool first = true;
 	QPainter painter(m_printer);
 	for (auto diagram : selectedDiagram())
 	{
 		first ? first = false : m_printer->newPage();
-		printDiagram(diagram, ui->m_fit_in_page_cb->isChecked(), &painter, m_printer);
+
+		const auto pages_count = pagesCount(diagram, fit_page);
+		auto render = render_all
+				|| m_pages_cache.value(diagram).contains(key);
+		for (auto i=page_index ; !render && i<page_index+pages_count ; ++i) {
+			render = visible_pages.contains(i);
+		}
+
+		if (render) {
+			printDiagram(diagram, fit_page, &painter, m_printer);
+		}
+		else
+		{
+			for (auto i=0 ; i<pages_count ; ++i)
+			{
+				if (i) {
+					m_printer->newPage();
+				}
+				m_placeholder_pages.insert(page_index + i);
+			}
+		}
+		page_index += pages_count;
+	}
+
+		//The pages can move in the preview (diagram checked or unchecked...),
+		//check the visible pages again once the preview is updated.
+	if (!m_placeholder_pages.isEmpty()) {
+		m_visible_pages_timer.start();
 	}
 }
 
 /**
  * @brief ProjectPrintWindow::printDiagram
- * Print @diagram on the @printer
+ * Print @diagram on the @printer.
+ * The pages of the diagram are rendered once for each print options,
+ * the pages already rendered are only replayed on the printer.
  * @param diagram
  * @param fit_page
  * @param printer
  */
 void ProjectPrintWindow::printDiagram(Diagram *diagram, bool fit_page, QPainter *painter, QPrinter *printer)
 {
+	const auto key = pagesCacheKey(fit_page, printer);
+	auto &diagram_cache = m_pages_cache[diagram];
+	if (!diagram_cache.contains(key)) {
+		diagram_cache.insert(key, renderDiagramPages(diagram, fit_page, printer));
+	}
+
+	const auto pages = diagram_cache.value(key);
+	for (auto i=0 ; i<pages.size() ; ++i)
+	{
+		if (i) {
+			printer->newPage();
+		}
+		painter->drawPicture(0, 0, pages.at(i));
+	}
+}
+
+/**
+ * @brief ProjectPrintWindow::renderDiagramPages
+ * Render @diagram in one picture by page to print
+ * @param diagram
+ * @param fit_page
+ * @param printer
+ * @return the pages to print
+ */
+QVector<QPicture> ProjectPrintWindow::renderDiagramPages(Diagram *diagram, bool fit_page, QPrinter *printer)
+{
+	QVector<QPicture> pages;
 
 	////Prepare the print////
 		//Deselect all
@@ -256,7 +355,16 @@ void ProjectPrintWindow::printDiagram(Diagram *diagram, bool fit_page, QPainter
 	auto full_page = printer->fullPage();
 	auto diagram_rect = diagramRect(diagram, option);
 	if (fit_page) {
-		diagram->render(painter, QRectF(), diagram_rect, Qt::KeepAspectRatio);
+		QPicture page;
+		QPainter painter(&page);
+			//A picture has no size, the target is the printable area
+			//of the printer in device pixels
+		diagram->render(&painter,
+				QRectF(0, 0, printer->width(), printer->height()),
+				diagram_rect,
+				Qt::KeepAspectRatio);
+		painter.end();
+		pages << page;
 	} else {
 		// Print on one or several pages
 #if QT_VERSION < QT_VERSION_CHECK(5, 15, 1) // ### Qt 6: remove
@@ -308,11 +416,13 @@ void ProjectPrintWindow::printDiagram(Diagram *diagram, bool fit_page, QPainter
 		}
 
 			//Scrolls through the page for print
-		bool first_ = true;
 		for (auto page : page_to_print)
 		{
-			first_ ? first_ = false : m_printer->newPage();
-			diagram->render(painter, QRect(QPoint(0,0), page.size()), page.translated(diagram_rect.topLeft()), Qt::KeepAspectRatio);
+			QPicture picture;
+			QPainter painter(&picture);
+			diagram->render(&painter, QRect(QPoint(0,0), page.size()), page.translated(diagram_rect.topLeft()), Qt::KeepAspectRatio);
+			painter.end();
+			pages << picture;
 		}
 	}
 
@@ -324,6 +434,131 @@ void ProjectPrintWindow::printDiagram(Diagram *diagram, bool fit_page, QPainter
 		qgi->setFlag(QGraphicsItem::ItemIsFocusable, true);
 	}
 	saveReloadDiagramParameters(diagram, option, false);
+
+	return pages;
+}
+
+/**
+ * @brief ProjectPrintWindow::pagesCacheKey
+ * @param fit_page
+ * @param printer
+ * @return a key which identify the print options and the page layout of @printer,
+ * the pages of a diagram rendered with the same key are identical.
+ */
+QString ProjectPrintWindow::pagesCacheKey(bool fit_page, const QPrinter *printer) const
+{
+	const auto option = exportProperties();
+	const auto resolution = printer->resolution();
+	const auto full_rect = printer->pageLayout().fullRectPixels(resolution);
+	const auto paint_rect = printer->pageLayout().paintRectPixels(resolution);
+
+	QStringList key;
+	key << QString::number(option.draw_border)
+		<< QString::number(option.draw_titleblock)
+		<< QString::number(option.draw_terminals)
+		<< QString::number(option.draw_colored_conductors)
+		<< QString::number(fit_page)
+		<< QString::number(printer->fullPage())
+		<< QString::number(resolution)
+		<< QString::number(full_rect.width())
+		<< QString::number(full_rect.height())
+		<< QString::number(paint_rect.width())
+		<< QString::number(paint_rect.height());
+	return key.join(QLatin1Char(';'));
+}
+
+/**
+ * @brief ProjectPrintWindow::clearPagesCache
+ * Clear the rendered pages of all diagrams,
+ * they will be rendered again at the next update of the preview.
+ */
+void ProjectPrintWindow::clearPagesCache()
+{
+	m_pages_cache.clear();
+}
+
+/**
+ * @brief ProjectPrintWindow::pagesCount
+ * @param diagram
+ * @param fit_page
+ * @return the number of pages used to print @diagram
+ */
+int ProjectPrintWindow::pagesCount(Diagram *diagram, bool fit_page) const
+{
+	if (fit_page) {
+		return 1;
+	}
+
+	const auto option = exportProperties();
+	const auto full_page = m_printer->fullPage();
+	return horizontalPagesCount(diagram, option, full_page)
+			* verticalPagesCount(diagram, option, full_page);
+}
+
+/**
+ * @brief ProjectPrintWindow::previewView
+ * QPrintPreviewWidget doesn't give the visible pages,
+ * they are found in its private QGraphicsView : a scene with
+ * one top level item per page, in the order of the pages.
+ * This depends on the internals of QPrintPreviewWidget,
+ * which can change with the version of Qt.
+ * @return the view of the preview, or nullptr if the view isn't found
+ * or if its scene doesn't have one item per page.
+ */
+QGraphicsView *ProjectPrintWindow::previewView() const
+{
+	auto view = m_preview->findChild<QGraphicsView *>();
+	if (!view || !view->scene()) {
+		return nullptr;
+	}
+
+	auto items_count = 0;
+	for (auto item : view->scene()->items()) {
+		if (!item->parentItem()) {
+			++items_count;
+		}
+	}
+	return items_count == m_preview->pageCount() ? view : nullptr;
+}
+
+/**
+ * @brief ProjectPrintWindow::visiblePreviewPages
+ * @return the index (from 0) of the pages visible in the preview.
+ * Before the first preview, the current page and the next one.
+ * @see previewView
+ */
+QSet<int> ProjectPrintWindow::visiblePreviewPages() const
+{
+	QSet<int> visible_pages;
+
+	if (auto view = previewView())
+	{
+			//The preview add one item per page, in the order of the pages
+		const auto pages = view->scene()->items(Qt::AscendingOrder);
+		for (auto item : view->items(view->viewport()->rect())) {
+			visible_pages.insert(pages.indexOf(item));
+		}
+		visible_pages.remove(-1);
+	}
+
+	if (visible_pages.isEmpty())
+	{
+		const auto current_page = qMax(m_preview->currentPage() - 1, 0);
+		visible_pages << current_page << current_page + 1;
+	}
+
+	return visible_pages;
+}
+
+/**
+ * @brief ProjectPrintWindow::renderVisiblePages
+ * Update the preview if a page left blank is now visible
+ */
+void ProjectPrintWindow::renderVisiblePages()
+{
+	if (visiblePreviewPages().intersects(m_placeholder_pages)) {
+		m_preview->updatePreview();
+	}
 }
 
 /**
@@ -332,7 +567,7 @@ void ProjectPrintWindow::printDiagram(Diagram *diagram, bool fit_page, QPainter
  * @param option
  * @return The rectangle of diagram to be printed
  */
-QRect ProjectPrintWindow::diagramRect(Diagram *diagram, const ExportProperties &option) const
+QRect ProjectPrintWindow::diagramRect(Diagram *diagram, const ExportProperties &option)
 {
 	auto diagram_rect = diagram->border_and_titleblock.borderAndTitleBlockRect();
 	if (!option.draw_titleblock) {
@@ -771,7 +1006,9 @@ void ProjectPrintWindow::on_m_uncheck_all_clicked()
 
 void ProjectPrintWindow::print()
 {
+	m_render_all_pages = true;
 	m_preview->print();
+	m_render_all_pages = false;
 	savePageSetupForCurrentPrinter();
 	this->close();
 }
@@ -20,14 +20,20 @@
 
 #include "../exportproperties.h"
 
+#include <QHash>
 #include <QMainWindow>
+#include <QPicture>
 #include <QPrinter>
+#include <QSet>
+#include <QTimer>
+#include <QVector>
 
 namespace Ui {
 class ProjectPrintWindow;
 }
 
 class QETProject;
+class QGraphicsView;
 class QPrintPreviewWidget;
 class QPrinter;
 class ExportProperties;
@@ -45,6 +51,7 @@ class ProjectPrintWindow : public QMainWindow
 	public:
 		static void launchDialog(QETProject *project, QPrinter::OutputFormat format = QPrinter::NativeFormat, QWidget *parent = nullptr);
 		static QString docName(QETProject *project);
+		static QRect diagramRect(Diagram *diagram, const ExportProperties &option);
 
 		explicit ProjectPrintWindow(QETProject *project, QPrinter *printer, QWidget *parent = nullptr);
 		~ProjectPrintWindow();
@@ -80,7 +87,13 @@ class ProjectPrintWindow : public QMainWindow
 	private:
 		void requestPaint();
 		void printDiagram(Diagram *diagram, bool fit_page, QPainter *painter, QPrinter *printer);
-		QRect diagramRect(Diagram *diagram, const ExportProperties &option) const;
+		QVector<QPicture> renderDiagramPages(Diagram *diagram, bool fit_page, QPrinter *printer);
+		QString pagesCacheKey(bool fit_page, const QPrinter *printer) const;
+		void clearPagesCache();
+		int pagesCount(Diagram *diagram, bool fit_page) const;
+		QGraphicsView *previewView() const;
+		QSet<int> visiblePreviewPages() const;
+		void renderVisiblePages();
 		int horizontalPagesCount(Diagram *diagram, const ExportProperties &option, bool full_page) const;
 		int verticalPagesCount(Diagram *diagram, const ExportProperties &option, bool full_page) const;
 		ExportProperties exportProperties() const;
@@ -100,6 +113,15 @@ class ProjectPrintWindow : public QMainWindow
 		QPrintPreviewWidget *m_preview=nullptr;
 		QColor m_backup_diagram_background_color;
 		QHash<Diagram *, QCheckBox *> m_diagram_list_hash;
+			//Rendered pages of each diagram, by print options (see pagesCacheKey).
+			//Cleared when the project is modified.
+		QHash<Diagram *, QHash<QString, QVector<QPicture>>> m_pages_cache;
+			//Pages of the preview left blank because they weren't visible,
+			//the diagrams of these pages are rendered when they are scrolled into view.
+		QSet<int> m_placeholder_pages;
+		QTimer m_visible_pages_timer;
+			//True when printing, every page must be rendered
+		bool m_render_all_pages = false;
 };
 
 #endif // PROJECTPRINTWINDOW_H
@@ -0,0 +1,395 @@
+/*
+	Copyright 2006-2024 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "projectbatchexporter.h"
+
+#include "diagram.h"
+#include "exportdialog.h"
+#include "exportproperties.h"
+#include "print/projectprintwindow.h"
+#include "qetarguments.h"
+#include "qetproject.h"
+
+#include <QBuffer>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QPainter>
+#include <QPrinter>
+#include <QTextStream>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+/**
+	@brief ProjectBatchExporter::ProjectBatchExporter
+	@param arguments : the command line arguments,
+	the format, the directory and the project files are read from it.
+*/
+ProjectBatchExporter::ProjectBatchExporter(const QETArguments &arguments) :
+	m_format(arguments.exportFormat()),
+	m_directory(arguments.exportDir()),
+	m_project_files(arguments.projectFiles())
+{}
+
+/**
+	@brief ProjectBatchExporter::requested
+	Check the raw arguments of the application for the option --export,
+	to know if the application must be started without window.
+	Can be called before the creation of the QApplication.
+	@param argc
+	@param argv
+	@return true if a batch export is requested
+	@see QETArguments::exportRequested
+*/
+bool ProjectBatchExporter::requested(int argc, char **argv)
+{
+	for (int i = 1 ; i < argc ; ++i)
+	{
+		const QByteArray argument(argv[i]);
+		if ((argument == "--export" && i + 1 < argc)
+			|| (argument.startsWith("--export=")
+				&& argument.size() > int(qstrlen("--export=")))) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+	@brief ProjectBatchExporter::exec
+	Export all the projects and print the timing summary
+	@return an ExitCode
+*/
+int ProjectBatchExporter::exec()
+{
+	QTextStream err(stderr);
+	const QStringList formats{"pdf", "svg", "png", "dxf"};
+	if (!formats.contains(m_format))
+	{
+		err << tr("Format d'export inconnu : %1 (pdf, svg, png ou dxf attendu)")
+			   .arg(m_format) << "\n";
+		return InvalidArguments;
+	}
+	if (m_project_files.isEmpty())
+	{
+		err << tr("Aucun projet à exporter") << "\n";
+		return InvalidArguments;
+	}
+
+	QDir directory(m_directory.isEmpty() ? QDir::currentPath()
+					     : m_directory);
+	if (!directory.mkpath(QStringLiteral(".")))
+	{
+		err << tr("Impossible de créer le dossier %1")
+			   .arg(directory.absolutePath()) << "\n";
+		return InvalidArguments;
+	}
+
+	QElapsedTimer timer;
+	timer.start();
+
+	int exit_code = Success;
+	for (const QString &file_path : qAsConst(m_project_files))
+	{
+		QETProject *project = new QETProject(file_path);
+		if (project->state() != QETProject::Ok)
+		{
+			err << tr("Impossible d'ouvrir le projet %1").arg(file_path) << "\n";
+			err.flush();
+			delete project;
+			if (exit_code == Success) {
+				exit_code = ProjectOpenFailed;
+			}
+			continue;
+		}
+
+			//Several projects : one sub-directory per project,
+			//because the folios of two projects can have the same file name.
+		QDir project_directory(directory);
+		if (m_project_files.count() > 1)
+		{
+			const QString name = QFileInfo(file_path).completeBaseName();
+			if (!project_directory.mkpath(name) || !project_directory.cd(name))
+			{
+				err << tr("Impossible de créer le dossier %1")
+					   .arg(project_directory.absoluteFilePath(name)) << "\n";
+				err.flush();
+				delete project;
+				if (exit_code == Success) {
+					exit_code = ExportFailed;
+				}
+				continue;
+			}
+		}
+
+		if (!exportProject(project, project_directory) && exit_code == Success) {
+			exit_code = ExportFailed;
+		}
+		delete project;
+	}
+
+	waitWrites(0);
+	for (const FolioExport &folio : qAsConst(m_folios))
+	{
+		if (folio.m_write_time == -1)
+		{
+			err << tr("Impossible d'écrire le fichier %1").arg(folio.m_file_path) << "\n";
+			if (exit_code == Success) {
+				exit_code = ExportFailed;
+			}
+		}
+	}
+	err.flush();
+
+	printSummary(timer.elapsed());
+	return exit_code;
+}
+
+/**
+	@brief ProjectBatchExporter::exportProject
+	Export all the folios of project in directory.
+	The png and svg files are written in the thread pool,
+	the result of the writing is read by waitWrites.
+	@param project
+	@param directory
+	@return false if an error occurred while rendering
+*/
+bool ProjectBatchExporter::exportProject(QETProject *project,
+					 const QDir &directory)
+{
+	if (m_format == QLatin1String("pdf")) {
+		return exportPdf(project, directory);
+	}
+
+	ExportProperties properties = ExportProperties::defaultExportProperties();
+	properties.format = m_format.toUpper();
+	properties.destination_directory = directory.absolutePath();
+
+		//Limit the number of rendered folios waiting to be written
+	const int max_pending = QThreadPool::globalInstance()->maxThreadCount() * 2;
+
+	for (Diagram *diagram : project->diagrams())
+	{
+		FolioExport folio;
+		folio.m_name = ExportDialog::diagramFileName(diagram);
+		folio.m_file_path = directory.absoluteFilePath(folio.m_name + "." + m_format);
+		const QSize size = ExportDialog::diagramSize(diagram, properties);
+		const QString file_path = folio.m_file_path;
+
+		QElapsedTimer timer;
+		timer.start();
+
+		if (m_format == QLatin1String("dxf"))
+		{
+				//generateDxf read the items of the folio while it write
+				//the file, the folios are written in the main thread.
+			const bool written = ExportDialog::generateDxf(diagram,
+									size.width(),
+									size.height(),
+									folio.m_file_path,
+									properties);
+			folio.m_render_time = timer.elapsed();
+			folio.m_write_time = written ? 0 : -1;
+			m_folios << folio;
+			continue;
+		}
+
+		QFuture<qint64> write;
+		if (m_format == QLatin1String("png"))
+		{
+			const QImage image = ExportDialog::generateImage(diagram,
+									 size.width(),
+									 size.height(),
+									 true,
+									 properties);
+			folio.m_render_time = timer.elapsed();
+			write = QtConcurrent::run([image, file_path]() -> qint64
+			{
+				QElapsedTimer timer;
+				timer.start();
+				return image.save(file_path, "PNG") ? timer.elapsed() : -1;
+			});
+		}
+		else
+		{
+			QByteArray svg;
+			QBuffer buffer(&svg);
+			ExportDialog::generateSvg(diagram,
+						  size.width(),
+						  size.height(),
+						  true,
+						  buffer,
+						  properties);
+			folio.m_render_time = timer.elapsed();
+			write = QtConcurrent::run([svg, file_path]() -> qint64
+			{
+				QElapsedTimer timer;
+				timer.start();
+				QFile file(file_path);
+				if (!file.open(QIODevice::WriteOnly)
+					|| file.write(svg) != svg.size()) {
+					return -1;
+				}
+				return timer.elapsed();
+			});
+		}
+
+		m_pending_writes << qMakePair(int(m_folios.size()), write);
+		m_folios << folio;
+		waitWrites(max_pending);
+	}
+
+	return true;
+}
+
+/**
+	@brief ProjectBatchExporter::exportPdf
+	Write all the folios of project in one pdf file, one folio per page,
+	fitted in the page like ProjectPrintWindow does.
+	The file is written while the folios are rendered,
+	so the write time of each folio is 0.
+	@param project
+	@param directory
+	@return false if the pdf file can't be written
+*/
+bool ProjectBatchExporter::exportPdf(QETProject *project, const QDir &directory)
+{
+	const QList<Diagram *> diagrams = project->diagrams();
+	if (diagrams.isEmpty()) {
+		return true;
+	}
+
+	const ExportProperties properties = ExportProperties::defaultPrintProperties();
+	const QString doc_name = ProjectPrintWindow::docName(project);
+	const QString file_path = directory.absoluteFilePath(doc_name + ".pdf");
+
+	QPrinter printer(QPrinter::HighResolution);
+	printer.setOutputFormat(QPrinter::PdfFormat);
+	printer.setOutputFileName(file_path);
+	printer.setDocName(doc_name);
+	printer.setCreator(QStringLiteral("QElectroTech"));
+	printer.setPageSize(QPageSize(QPageSize::A4));
+
+	const QColor background_color = Diagram::background_color;
+	Diagram::background_color = Qt::white;
+
+	const int first_folio = m_folios.size();
+	QPainter painter;
+	for (Diagram *diagram : diagrams)
+	{
+		const QRect diagram_rect = ProjectPrintWindow::diagramRect(diagram, properties);
+		printer.setPageOrientation(diagram_rect.width() > diagram_rect.height()
+					   ? QPageLayout::Landscape
+					   : QPageLayout::Portrait);
+
+		if (!painter.isActive())
+		{
+			if (!painter.begin(&printer))
+			{
+				Diagram::background_color = background_color;
+				FolioExport folio;
+				folio.m_name = doc_name;
+				folio.m_file_path = file_path;
+				m_folios << folio;
+				return false;
+			}
+		}
+		else {
+			printer.newPage();
+		}
+
+		QElapsedTimer timer;
+		timer.start();
+
+		const ExportProperties diagram_properties = diagram->applyProperties(properties);
+		diagram->render(&painter, QRectF(), diagram_rect, Qt::KeepAspectRatio);
+		diagram->applyProperties(diagram_properties);
+
+		FolioExport folio;
+		folio.m_name = ExportDialog::diagramFileName(diagram);
+		folio.m_file_path = file_path;
+		folio.m_render_time = timer.elapsed();
+		folio.m_write_time = 0;
+		m_folios << folio;
+	}
+
+	const bool written = painter.end();
+	Diagram::background_color = background_color;
+
+	if (!written)
+	{
+		for (int i = first_folio ; i < m_folios.size() ; ++i) {
+			m_folios[i].m_write_time = -1;
+		}
+	}
+	return written;
+}
+
+/**
+	@brief ProjectBatchExporter::waitWrites
+	Wait for the oldest writings until there is no more
+	than max_pending writings in progress.
+	@param max_pending
+*/
+void ProjectBatchExporter::waitWrites(int max_pending)
+{
+	while (m_pending_writes.size() > max_pending)
+	{
+		const auto pending = m_pending_writes.takeFirst();
+		m_folios[pending.first].m_write_time = pending.second.result();
+	}
+}
+
+/**
+	@brief ProjectBatchExporter::printSummary
+	Print the render and write time of each folio on the standard output
+	@param elapsed : the total time of the export in ms
+*/
+void ProjectBatchExporter::printSummary(qint64 elapsed) const
+{
+	QTextStream out(stdout);
+	int failures = 0;
+
+	out << QString("%1 %2  %3\n")
+		   .arg(tr("rendu (ms)"), 10)
+		   .arg(tr("écriture (ms)"), 13)
+		   .arg(tr("fichier"));
+	for (const FolioExport &folio : m_folios)
+	{
+		QString write_time = QString::number(folio.m_write_time);
+		if (folio.m_write_time == -1)
+		{
+			write_time = tr("échec");
+			++failures;
+		}
+
+		QString file_name = QFileInfo(folio.m_file_path).fileName();
+		if (m_format == QLatin1String("pdf")) {
+			file_name += " : " + folio.m_name;
+		}
+
+		out << QString("%1 %2  %3\n")
+			   .arg(folio.m_render_time, 10)
+			   .arg(write_time, 13)
+			   .arg(file_name);
+	}
+
+	out << tr("%1 folio(s) exporté(s), %2 échec(s), en %3 ms")
+		   .arg(m_folios.size() - failures)
+		   .arg(failures)
+		   .arg(elapsed) << "\n";
+	out.flush();
+}
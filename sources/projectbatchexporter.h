@@ -0,0 +1,86 @@
+/*
+	Copyright 2006-2024 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef PROJECTBATCHEXPORTER_H
+#define PROJECTBATCHEXPORTER_H
+
+#include <QCoreApplication>
+#include <QDir>
+#include <QFuture>
+#include <QStringList>
+#include <QVector>
+
+class QETArguments;
+class QETProject;
+
+/**
+	@brief The ProjectBatchExporter class
+	Export every folio of the projects given on the command line,
+	without creating any window :
+	qelectrotech --export pdf|svg|png|dxf --out DIR project.qet...
+
+	A diagram is a QGraphicsScene, so the folios are rendered one after
+	the other in the main thread, with the same functions as ExportDialog.
+	The encoding and the writing of the png and svg files are done
+	in the global thread pool, while the next folio is rendered.
+	A pdf file is written for each project, with one folio per page.
+
+	When several projects are exported, the files of each project
+	are written in a sub-directory named after the project file.
+	A timing summary of each folio is printed on the standard output,
+	errors are printed on the standard error.
+*/
+class ProjectBatchExporter
+{
+	Q_DECLARE_TR_FUNCTIONS(ProjectBatchExporter)
+
+	public:
+			///The first error met gives the exit code
+		enum ExitCode {
+			Success           = 0, ///every folio was exported
+			InvalidArguments  = 1, ///bad format, directory or no project
+			ProjectOpenFailed = 2, ///a project can't be opened
+			ExportFailed      = 3  ///a folio can't be written
+		};
+
+		ProjectBatchExporter(const QETArguments &arguments);
+
+		static bool requested(int argc, char **argv);
+		int exec();
+
+	private:
+		struct FolioExport
+		{
+			QString m_name;
+			QString m_file_path;
+			qint64 m_render_time = 0; ///ms
+			qint64 m_write_time = -1; ///ms, -1 if the file can't be written
+		};
+
+		bool exportProject(QETProject *project, const QDir &directory);
+		bool exportPdf(QETProject *project, const QDir &directory);
+		void waitWrites(int max_pending);
+		void printSummary(qint64 elapsed) const;
+
+		QString m_format;
+		QString m_directory;
+		QStringList m_project_files;
+		QVector<FolioExport> m_folios;
+		QVector<QPair<int, QFuture<qint64>>> m_pending_writes;
+};
+
+#endif // PROJECTBATCHEXPORTER_H
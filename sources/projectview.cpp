@@ -43,6 +43,9 @@ ProjectView::ProjectView(QETProject *project, QWidget *parent) :
 	QWidget(parent),
 	m_project(nullptr)
 {
+	QSettings settings;
+	m_max_views = settings.value(QStringLiteral("diagrameditor/max-folio-views"), 0).toInt();
+
 	initActions();
 	initWidgets();
 	initLayout();
@@ -56,7 +59,7 @@ ProjectView::ProjectView(QETProject *project, QWidget *parent) :
 */
 ProjectView::~ProjectView()
 {
-	for (auto dv_ : m_diagram_ids.values())
+	for (auto dv_ : m_diagram_views)
 		dv_->deleteLater();
 }
 
@@ -94,11 +97,20 @@ void ProjectView::setProject(QETProject *project)
 }
 
 /**
-	@return la liste des schemas ouverts dans le projet
+	@return la liste des schemas ouverts dans le projet,
+	in the order of the tabs.
+	Only the diagrams which have been activated have a view,
+	use showDiagram to create the view of a diagram.
 */
 QList<DiagramView *> ProjectView::diagram_views() const
 {
-	return(m_diagram_view_list);
+	QList<DiagramView *> views;
+	for (int i = 0 ; i < m_tab->count() ; ++i) {
+		if (DiagramView *dv = m_diagram_views.value(diagramAt(i))) {
+			views << dv;
+		}
+	}
+	return(views);
 }
 
 /**
@@ -107,10 +119,7 @@ QList<DiagramView *> ProjectView::diagram_views() const
 */
 DiagramView *ProjectView::currentDiagram() const
 {
-	int current_tab_index = m_tab -> currentIndex();
-	if (current_tab_index == -1)
-		return nullptr;
-	return(m_diagram_ids[current_tab_index]);
+	return(m_diagram_views.value(diagramAt(m_tab -> currentIndex())));
 }
 
 /**
@@ -132,24 +141,10 @@ void ProjectView::closeEvent(QCloseEvent *qce) {
 */
 void ProjectView::changeTabDown()
 {
-	DiagramView *nextDiagramView = this->nextDiagram();
-	if (nextDiagramView!=nullptr){
-		rebuildDiagramsMap();
-		m_tab -> setCurrentWidget(nextDiagramView);
-	}
-}
-
-/**
-	@return next folio of current diagramview
-*/
-DiagramView *ProjectView::nextDiagram()
-{
-	int current_tab_index = m_tab -> currentIndex();
-	int next_tab_index = current_tab_index + 1;	//get next tab index
-	if (next_tab_index<m_diagram_ids.count()) //if next tab index >= greatest tab the last tab is activated so no need to change tab.
-		return(m_diagram_ids[next_tab_index]);
-	else
-		return nullptr;
+	int next_tab_index = m_tab -> currentIndex() + 1;
+		//if next tab index >= greatest tab the last tab is activated so no need to change tab.
+	if (next_tab_index < m_tab -> count())
+		m_tab -> setCurrentIndex(next_tab_index);
 }
 
 /**
@@ -157,24 +152,10 @@ DiagramView *ProjectView::nextDiagram()
 */
 void ProjectView::changeTabUp()
 {
-	DiagramView *previousDiagramView = this->previousDiagram();
-	if (previousDiagramView!=nullptr){
-		rebuildDiagramsMap();
-		m_tab -> setCurrentWidget(previousDiagramView);
-	}
-}
-
-/**
-	@return previous folio of current diagramview
-*/
-DiagramView *ProjectView::previousDiagram()
-{
-	int current_tab_index = m_tab -> currentIndex();
-	int previous_tab_index = current_tab_index - 1;	//get previous tab index
-	if (previous_tab_index>=0) //if previous tab index = 0 then the first tab is activated so no need to change tab.
-		return(m_diagram_ids[previous_tab_index]);
-	else
-		return nullptr;
+	int previous_tab_index = m_tab -> currentIndex() - 1;
+		//if previous tab index = 0 then the first tab is activated so no need to change tab.
+	if (previous_tab_index >= 0)
+		m_tab -> setCurrentIndex(previous_tab_index);
 }
 
 /**
@@ -182,16 +163,7 @@ DiagramView *ProjectView::previousDiagram()
 */
 void ProjectView::changeLastTab()
 {
-	DiagramView *lastDiagramView = this->lastDiagram();
-	m_tab->setCurrentWidget(lastDiagramView);
-}
-
-/**
-	@return last folio of current project
-*/
-DiagramView *ProjectView::lastDiagram()
-{
-	return(m_diagram_ids.last());
+	m_tab -> setCurrentIndex(m_tab -> count() - 1);
 }
 
 /**
@@ -199,16 +171,8 @@ DiagramView *ProjectView::lastDiagram()
 */
 void ProjectView::changeFirstTab()
 {
-	DiagramView *firstDiagramView = this->firstDiagram();
-	m_tab->setCurrentWidget(firstDiagramView);
-}
-
-/**
-	@return first folio of current project
-*/
-DiagramView *ProjectView::firstDiagram()
-{
-	return(m_diagram_ids.first());
+	if (m_tab -> count())
+		m_tab -> setCurrentIndex(0);
 }
 
 
@@ -372,9 +336,21 @@ void ProjectView::removeDiagram(DiagramView *diagram_view)
 {
 	if (!diagram_view)
 		return;
+	removeDiagram(diagram_view -> diagram());
+}
+
+/**
+	@brief ProjectView::removeDiagram
+	Remove a diagram (folio) of the project
+	@param diagram : diagram to remove
+*/
+void ProjectView::removeDiagram(Diagram *diagram)
+{
+	if (!diagram)
+		return;
 	if (m_project -> isReadOnly())
 		return;
-	if (!m_diagram_ids.values().contains(diagram_view))
+	if (!m_diagram_tabs.contains(diagram))
 		return;
 
 
@@ -390,49 +366,41 @@ void ProjectView::removeDiagram(DiagramView *diagram_view)
 		return;
 	}
 
-	//Remove the diagram view of the tabs widget
-	int index_to_remove = m_diagram_ids.key(diagram_view);
-	m_tab->removeTab(index_to_remove);
-	m_diagram_view_list.removeAll(diagram_view);
-	rebuildDiagramsMap();
+	//Remove the tab of the diagram, the view is deleted with the tab page
+	QWidget *page = m_diagram_tabs.take(diagram);
+	m_tab_diagrams.remove(page);
+	m_tab->removeTab(m_tab->indexOf(page));
+	DiagramView *diagram_view = m_diagram_views.take(diagram);
+	m_activated_diagrams.removeAll(diagram);
 
-	m_project -> removeDiagram(diagram_view -> diagram());
-	delete diagram_view;
+	m_project -> removeDiagram(diagram);
+	delete page;
 
-	emit(diagramRemoved(diagram_view));
+	if (diagram_view) {
+		emit(diagramRemoved(diagram_view));
+	}
 	updateAllTabsTitle();
 	m_project -> setModified(true);
 }
 
-/**
-	Enleve un schema du ProjectView
-	@param diagram Schema a enlever
-*/
-void ProjectView::removeDiagram(Diagram *diagram) {
-	if (!diagram) return;
-
-	if (DiagramView *diagram_view = findDiagram(diagram)) {
-		removeDiagram(diagram_view);
-	}
-}
-
 /**
 	Active l'onglet adequat pour afficher le schema passe en parametre
 	@param diagram Schema a afficher
 */
 void ProjectView::showDiagram(DiagramView *diagram) {
 	if (!diagram) return;
-	m_tab -> setCurrentWidget(diagram);
+	showDiagram(diagram -> diagram());
 }
 
 /**
-	Active l'onglet adequat pour afficher le schema passe en parametre
+	Active l'onglet adequat pour afficher le schema passe en parametre.
+	The view of the diagram is created if needed.
 	@param diagram Schema a afficher
 */
 void ProjectView::showDiagram(Diagram *diagram) {
 	if (!diagram) return;
-	if (DiagramView *diagram_view = findDiagram(diagram)) {
-		m_tab -> setCurrentWidget(diagram_view);
+	if (QWidget *page = m_diagram_tabs.value(diagram)) {
+		m_tab -> setCurrentWidget(page);
 	}
 }
 
@@ -468,6 +436,7 @@ void ProjectView::editDiagramProperties(DiagramView *diagram_view) {
 	Edite les proprietes du schema diagram
 */
 void ProjectView::editDiagramProperties(Diagram *diagram) {
+	showDiagram(diagram);
 	editDiagramProperties(findDiagram(diagram));
 }
 
@@ -476,20 +445,19 @@ void ProjectView::editDiagramProperties(Diagram *diagram) {
 */
 void ProjectView::moveDiagramUp(DiagramView *diagram_view) {
 	if (!diagram_view) return;
-
-	int diagram_view_position = m_diagram_ids.key(diagram_view);
-	if (!diagram_view_position) {
-		// le schema est le premier du projet
-		return;
-	}
-	m_tab -> tabBar() -> moveTab(diagram_view_position, diagram_view_position - 1);
+	moveDiagramUp(diagram_view -> diagram());
 }
 
 /**
 	Deplace le schema diagram vers le haut / la gauche
 */
 void ProjectView::moveDiagramUp(Diagram *diagram) {
-	moveDiagramUp(findDiagram(diagram));
+	int diagram_position = tabIndex(diagram);
+	if (diagram_position <= 0) {
+		// le schema est le premier du projet
+		return;
+	}
+	m_tab -> tabBar() -> moveTab(diagram_position, diagram_position - 1);
 }
 
 /**
@@ -497,20 +465,19 @@ void ProjectView::moveDiagramUp(Diagram *diagram) {
 */
 void ProjectView::moveDiagramDown(DiagramView *diagram_view) {
 	if (!diagram_view) return;
-
-	int diagram_view_position = m_diagram_ids.key(diagram_view);
-	if (diagram_view_position + 1 == m_diagram_ids.count()) {
-		// le schema est le dernier du projet
-		return;
-	}
-	m_tab -> tabBar() -> moveTab(diagram_view_position, diagram_view_position + 1);
+	moveDiagramDown(diagram_view -> diagram());
 }
 
 /**
 	Deplace le schema diagram vers le bas / la droite
 */
 void ProjectView::moveDiagramDown(Diagram *diagram) {
-	moveDiagramDown(findDiagram(diagram));
+	int diagram_position = tabIndex(diagram);
+	if (diagram_position == -1 || diagram_position + 1 == m_tab -> count()) {
+		// le schema est le dernier du projet
+		return;
+	}
+	m_tab -> tabBar() -> moveTab(diagram_position, diagram_position + 1);
 }
 
 /*
@@ -519,13 +486,7 @@ void ProjectView::moveDiagramDown(Diagram *diagram) {
 void ProjectView::moveDiagramUpTop(DiagramView *diagram_view)
 {
 	if (!diagram_view) return;
-
-	int diagram_view_position = m_diagram_ids.key(diagram_view);
-	if (!diagram_view_position) {
-		// le schema est le premier du projet
-		return;
-	}
-	m_tab->tabBar()->moveTab(diagram_view_position, 0);
+	moveDiagramUpTop(diagram_view -> diagram());
 }
 
 /*
@@ -533,7 +494,12 @@ void ProjectView::moveDiagramUpTop(DiagramView *diagram_view)
 */
 void ProjectView::moveDiagramUpTop(Diagram *diagram)
 {
-	moveDiagramUpTop(findDiagram(diagram));
+	int diagram_position = tabIndex(diagram);
+	if (diagram_position <= 0) {
+		// le schema est le premier du projet
+		return;
+	}
+	m_tab->tabBar()->moveTab(diagram_position, 0);
 }
 
 /**
@@ -541,20 +507,19 @@ void ProjectView::moveDiagramUpTop(Diagram *diagram)
 */
 void ProjectView::moveDiagramUpx10(DiagramView *diagram_view) {
 	if (!diagram_view) return;
-
-	int diagram_view_position = m_diagram_ids.key(diagram_view);
-	if (!diagram_view_position) {
-		// le schema est le premier du projet
-		return;
-	}
-	m_tab -> tabBar() -> moveTab(diagram_view_position, diagram_view_position - 10);
+	moveDiagramUpx10(diagram_view -> diagram());
 }
 
 /**
 	Deplace le schema diagram vers le haut / la gauche x10
 */
 void ProjectView::moveDiagramUpx10(Diagram *diagram) {
-	moveDiagramUpx10(findDiagram(diagram));
+	int diagram_position = tabIndex(diagram);
+	if (diagram_position <= 0) {
+		// le schema est le premier du projet
+		return;
+	}
+	m_tab -> tabBar() -> moveTab(diagram_position, diagram_position - 10);
 }
 
 /**
@@ -562,20 +527,19 @@ void ProjectView::moveDiagramUpx10(Diagram *diagram) {
 */
 void ProjectView::moveDiagramDownx10(DiagramView *diagram_view) {
 	if (!diagram_view) return;
-
-	int diagram_view_position = m_diagram_ids.key(diagram_view);
-	if (diagram_view_position + 1 == m_diagram_ids.count()) {
-		// le schema est le dernier du projet
-		return;
-	}
-	m_tab -> tabBar() -> moveTab(diagram_view_position, diagram_view_position + 10);
+	moveDiagramDownx10(diagram_view -> diagram());
 }
 
 /**
 	Deplace le schema diagram vers le bas / la droite x10
 */
 void ProjectView::moveDiagramDownx10(Diagram *diagram) {
-	moveDiagramDownx10(findDiagram(diagram));
+	int diagram_position = tabIndex(diagram);
+	if (diagram_position == -1 || diagram_position + 1 == m_tab -> count()) {
+		// le schema est le dernier du projet
+		return;
+	}
+	m_tab -> tabBar() -> moveTab(diagram_position, diagram_position + 10);
 }
 
 /**
@@ -717,10 +681,10 @@ void ProjectView::initActions()
 	connect(m_add_new_diagram, &QAction::triggered, [this](){this->m_project->addNewDiagram();});
 	
 	m_first_view = new QAction(QET::Icons::ArrowLeftDouble, tr("Revenir au debut du projet"),this);
-	connect(m_first_view, &QAction::triggered, [this](){this->m_tab->setCurrentWidget(firstDiagram());});
+	connect(m_first_view, &QAction::triggered, [this](){this->changeFirstTab();});
 	
 	m_end_view = new QAction(QET::Icons::ArrowRightDouble, tr("Aller à la fin du projet"),this);
-	connect(m_end_view, &QAction::triggered, [this](){this->m_tab->setCurrentWidget(lastDiagram());});
+	connect(m_end_view, &QAction::triggered, [this](){this->changeLastTab();});
 }
 
 /**
@@ -804,8 +768,8 @@ void ProjectView::initLayout()
 /**
 	@brief ProjectView::loadDiagrams
 	Load diagrams of project.
-	We create a diagram view for each diagram,
-	and add it to the project view.
+	We create a tab for each diagram, the diagram view
+	is created when the tab is activated for the first time.
 */
 void ProjectView::loadDiagrams()
 {
@@ -830,23 +794,19 @@ void ProjectView::loadDiagrams()
 			dialog->setProgressBar(dialog->progressBarValue()+1);
 		}
 
-		auto dv = new DiagramView(diagram);
-		dv->setFrameStyle(QFrame::Plain | QFrame::NoFrame);
+		addDiagramTab(diagram);
 
-		auto index = m_project->folioIndex(diagram);
-		m_tab->insertTab(index, dv, QET::Icons::Diagram, dv->title());
-		m_diagram_view_list.insert(index, dv);
-
-		connect(dv, &DiagramView::showDiagram,         this, QOverload<Diagram*>::of(&ProjectView::showDiagram));
-		connect(dv, &DiagramView::titleChanged,        this, &ProjectView::updateTabTitle);
-		connect(dv, &DiagramView::findElementRequired, this, &ProjectView::findElementRequired);
-		connect(&dv->diagram()->border_and_titleblock , &BorderTitleBlock::titleBlockFolioChanged, [this, dv]() {this->updateTabTitle(dv);});
+			//Done by the constructor of DiagramView before,
+			//the view of most diagrams is now created later.
+		diagram->loadElmtFolioSeq();
+		diagram->loadCndFolioSeq();
 	}
 
-	rebuildDiagramsMap();
 	updateAllTabsTitle();
 
-	m_tab->setCurrentWidget(firstDiagram());
+	if (m_tab->count())
+		m_tab->setCurrentIndex(0);
+	m_project->undoStack()->setClean();
 }
 
 /**
@@ -888,25 +848,96 @@ void ProjectView::adjustReadOnlyState()
 */
 void ProjectView::diagramAdded(Diagram *diagram)
 {
-	auto dv = new DiagramView(diagram);
-	auto index = m_project->folioIndex(diagram);
-	m_tab->insertTab(index, dv, QET::Icons::Diagram, dv->title());
-	dv->setFrameStyle(QFrame::Plain | QFrame::NoFrame);
+	addDiagramTab(diagram);
+	updateAllTabsTitle();
+
+		// signal diagram view was added
+	diagramView(diagram);
+	m_project->undoStack()->setClean();
+	m_project->setModified(true);
+	showDiagram(diagram);
+}
 
-	m_diagram_view_list.insert(index, dv);
+/**
+	@brief ProjectView::addDiagramTab
+	Insert an empty tab for diagram at the position of diagram
+	in the project, and connect the signals of diagram
+	which don't need a diagram view.
+	@param diagram
+*/
+void ProjectView::addDiagramTab(Diagram *diagram)
+{
+	QWidget *page = new QWidget();
+	QVBoxLayout *page_layout = new QVBoxLayout(page);
+	page_layout->setContentsMargins(0, 0, 0, 0);
+	page_layout->setSpacing(0);
+
+	m_diagram_tabs.insert(diagram, page);
+	m_tab_diagrams.insert(page, diagram);
+	m_tab->insertTab(m_project->folioIndex(diagram), page, QET::Icons::Diagram, diagram->title());
+
+	connect(diagram, &Diagram::showDiagram,         this, QOverload<Diagram*>::of(&ProjectView::showDiagram));
+	connect(diagram, &Diagram::diagramTitleChanged, this, QOverload<Diagram*>::of(&ProjectView::updateTabTitle));
+	connect(diagram, &Diagram::findElementRequired, this, &ProjectView::findElementRequired);
+	connect(&diagram->border_and_titleblock , &BorderTitleBlock::titleBlockFolioChanged, this, [this, diagram]() {this->updateTabTitle(diagram);});
+}
 
-	rebuildDiagramsMap();
-	updateAllTabsTitle();
+/**
+	@brief ProjectView::diagramView
+	@param diagram
+	@return the view of diagram, the view is created and added
+	in the tab of diagram if needed.
+	Return nullptr if diagram isn't a diagram of this project view.
+*/
+DiagramView *ProjectView::diagramView(Diagram *diagram)
+{
+	if (DiagramView *dv = m_diagram_views.value(diagram))
+		return dv;
 
-	connect(dv, &DiagramView::showDiagram,         this, QOverload<Diagram*>::of(&ProjectView::showDiagram));
-	connect(dv, &DiagramView::titleChanged,        this, &ProjectView::updateTabTitle);
-	connect(dv, &DiagramView::findElementRequired, this, &ProjectView::findElementRequired);
-	connect(&dv->diagram()->border_and_titleblock , &BorderTitleBlock::titleBlockFolioChanged, [this, dv]() {this->updateTabTitle(dv);});
+	QWidget *page = m_diagram_tabs.value(diagram);
+	if (!page)
+		return nullptr;
+
+	auto dv = new DiagramView(diagram, page);
+	dv->setFrameStyle(QFrame::Plain | QFrame::NoFrame);
+	page->layout()->addWidget(dv);
+	m_diagram_views.insert(diagram, dv);
 
-		// signal diagram view was added
 	emit(diagramAdded(dv));
-	m_project->setModified(true);
-	showDiagram(dv);
+	return dv;
+}
+
+/**
+	@brief ProjectView::evictIdleViews
+	Delete the views of the diagrams not activated recently,
+	until there is no more than m_max_views views.
+	The view of the current diagram is never deleted.
+*/
+void ProjectView::evictIdleViews()
+{
+	if (m_max_views <= 0)
+		return;
+
+	Diagram *current = diagramAt(m_tab->currentIndex());
+	int i = 0;
+	while (m_diagram_views.size() > m_max_views
+		   && i < m_activated_diagrams.size())
+	{
+		Diagram *diagram = m_activated_diagrams.at(i);
+		if (diagram == current) {
+			++i;
+			continue;
+		}
+
+		m_activated_diagrams.removeAt(i);
+		if (DiagramView *dv = m_diagram_views.take(diagram))
+		{
+			dv->hide();
+			if (QWidget *page = m_diagram_tabs.value(diagram))
+				page->layout()->removeWidget(dv);
+			dv->deleteLater();
+		}
+	}
 }
 
 /**
@@ -916,13 +947,23 @@ void ProjectView::diagramAdded(Diagram *diagram)
 */
 void ProjectView::updateTabTitle(DiagramView *diagram_view)
 {
-	int diagram_tab_id = m_diagram_ids.key(diagram_view, -1);
+	if (diagram_view)
+		updateTabTitle(diagram_view->diagram());
+}
+
+/**
+	@brief ProjectView::updateTabTitle
+	Update the title of the tab which display the diagram.
+	@param diagram : The diagram.
+*/
+void ProjectView::updateTabTitle(Diagram *diagram)
+{
+	int diagram_tab_id = tabIndex(diagram);
 	
 	if (diagram_tab_id != -1)
 	{
 		QSettings settings;
 		QString title;
-		Diagram *diagram = diagram_view->diagram();
 		
 		if (settings.value("genericpanel/folio", false).toBool())
 		{
@@ -948,8 +989,8 @@ void ProjectView::updateTabTitle(DiagramView *diagram_view)
 */
 void ProjectView::updateAllTabsTitle()
 {
-	for (DiagramView *dv : m_diagram_ids.values())
-		updateTabTitle(dv);
+	for (Diagram *diagram : m_diagram_tabs.keys())
+		updateTabTitle(diagram);
 }
 
 /**
@@ -962,43 +1003,49 @@ void ProjectView::tabMoved(int from, int to)
 		return;
 	
 	m_project->diagramOrderChanged(from, to);
-	rebuildDiagramsMap();
+	if (m_previous_tab_index == from)
+		m_previous_tab_index = to;
+	else if (m_previous_tab_index != -1
+			 && m_previous_tab_index >= qMin(from, to)
+			 && m_previous_tab_index <= qMax(from, to))
+		m_previous_tab_index += from < to ? -1 : 1;
 	
 		//Rebuild the title of each diagram in range from - to
 	for (int i= qMin(from,to) ; i< qMax(from,to)+1 ; ++i)
 	{
-		DiagramView *dv = m_diagram_ids.value(i);
-		updateTabTitle(dv);
+		updateTabTitle(diagramAt(i));
 	}
 }
 
 /**
 	@param diagram Schema a trouver
 	@return le DiagramView correspondant au schema passe en parametre, ou 0 si
-	le schema n'est pas trouve
+	le schema n'est pas trouve.
+	The view is created if needed.
 */
 DiagramView *ProjectView::findDiagram(Diagram *diagram) {
-	foreach(DiagramView *diagram_view, diagram_views()) {
-		if (diagram_view -> diagram() == diagram) {
-			return(diagram_view);
-		}
-	}
-	return(nullptr);
+	return(diagramView(diagram));
 }
 
 /**
-	Reconstruit la map associant les index des onglets avec les DiagramView
+	@param index Index d'un onglet
+	@return le schema affiche dans l'onglet index, ou 0 si l'index
+	ne correspond a aucun onglet
 */
-void ProjectView::rebuildDiagramsMap()
+Diagram *ProjectView::diagramAt(int index) const
 {
-	// vide la map
-	m_diagram_ids.clear();
+	return(m_tab_diagrams.value(m_tab -> widget(index)));
+}
 
-	foreach(DiagramView *diagram_view, m_diagram_view_list) {
-		int dv_idx = m_tab -> indexOf(diagram_view);
-		if (dv_idx == -1) continue;
-		m_diagram_ids.insert(dv_idx, diagram_view);
-	}
+/**
+	@param diagram Schema a trouver
+	@return l'index de l'onglet du schema, ou -1 si
+	le schema n'est pas trouve
+*/
+int ProjectView::tabIndex(Diagram *diagram) const
+{
+	QWidget *page = m_diagram_tabs.value(diagram);
+	return(page ? m_tab -> indexOf(page) : -1);
 }
 
 /**
@@ -1006,6 +1053,8 @@ void ProjectView::rebuildDiagramsMap()
 	Manage the tab change.
 	If tab_id == -1 (there is no diagram opened),
 	we display the fallback widget.
+	The view of the diagram is created
+	the first time its tab is activated.
 	@param tab_id
 */
 void ProjectView::tabChanged(int tab_id)
@@ -1015,15 +1064,25 @@ void ProjectView::tabChanged(int tab_id)
 	else if(m_tab->count() == 1)
 		setDisplayFallbackWidget(false);
 	
-	emit(diagramActivated(m_diagram_ids[tab_id]));
+	Diagram *diagram = diagramAt(tab_id);
+	DiagramView *dv = diagramView(diagram);
+	emit(diagramActivated(dv));
 	
-	if (m_diagram_ids[tab_id] != nullptr)
-		m_diagram_ids[tab_id]->diagram()->diagramActivated();
+	if (diagram)
+		diagram->diagramActivated();
 
 		//Clear the event interface of the previous diagram
-	if (DiagramView *dv = m_diagram_ids[m_previous_tab_index])
-		dv->diagram()->clearEventInterface();
+	if (Diagram *previous = diagramAt(m_previous_tab_index))
+		if (previous != diagram)
+			previous->clearEventInterface();
 	m_previous_tab_index = tab_id;
+
+	if (diagram)
+	{
+		m_activated_diagrams.removeAll(diagram);
+		m_activated_diagrams.append(diagram);
+		evictIdleViews();
+	}
 }
 
 /**
@@ -1032,10 +1091,10 @@ void ProjectView::tabChanged(int tab_id)
 */
 void ProjectView::tabDoubleClicked(int tab_id) {
 	// repere le schema concerne
-	DiagramView *diagram_view = m_diagram_ids[tab_id];
-	if (!diagram_view) return;
+	Diagram *diagram = diagramAt(tab_id);
+	if (!diagram) return;
 
-	diagram_view -> editDiagramProperties();
+	editDiagramProperties(diagram);
 }
 
 /**
@@ -75,6 +75,11 @@ class QVBoxLayout;
 	@brief The ProjectView class
 	This class provides a widget displaying the diagrams of a particular
 	project using tabs.
+	Each tab is an empty page until it is activated for the first time,
+	then the DiagramView of the diagram is created in the page.
+	The number of DiagramView kept alive can be limited
+	(setting "diagrameditor/max-folio-views"), the views which were
+	not activated recently are then deleted.
 */
 class ProjectView : public QWidget
 {
@@ -129,6 +134,7 @@ class ProjectView : public QWidget
 		int cleanProject();
 		void updateWindowTitle();
 		void updateTabTitle(DiagramView *);
+		void updateTabTitle(Diagram *);
 		void updateAllTabsTitle();
 		void tabMoved(int, int);
 
@@ -146,12 +152,12 @@ class ProjectView : public QWidget
 		void initWidgets();
 		void initLayout();
 		void loadDiagrams();
+		void addDiagramTab(Diagram *diagram);
 		DiagramView *findDiagram(Diagram *);
-		DiagramView *nextDiagram();
-		DiagramView *previousDiagram();
-		DiagramView *firstDiagram();
-		DiagramView *lastDiagram();
-		void rebuildDiagramsMap();
+		DiagramView *diagramView(Diagram *diagram);
+		Diagram *diagramAt(int index) const;
+		int tabIndex(Diagram *diagram) const;
+		void evictIdleViews();
 		bool tryClosing();
 		bool tryClosingElementEditors();
 		int tryClosingDiagrams();
@@ -181,9 +187,16 @@ class ProjectView : public QWidget
 		QTabWidget *m_tab;
 #endif
 
-		QMap<int, DiagramView *> m_diagram_ids;
+			///Tab page of each diagram, and diagram of each tab page
+		QHash<Diagram *, QWidget *> m_diagram_tabs;
+		QHash<QWidget *, Diagram *> m_tab_diagrams;
+			///The views created, only for the diagrams activated at least once
+		QHash<Diagram *, DiagramView *> m_diagram_views;
+			///Diagrams with a view, from the least to the most recently activated
+		QList<Diagram *> m_activated_diagrams;
+			///Maximum number of views kept alive, 0 for no limit
+		int m_max_views = 0;
 		int m_previous_tab_index = -1;
-		QList<DiagramView *> m_diagram_view_list;
 };
 
 
@@ -21,6 +21,7 @@
 #include "ui/configpage/configpages.h"
 #include "editor/ui/qetelementeditor.h"
 #include "elementscollectioncache.h"
+#include "factory/elementdefinitioncache.h"
 #include "factory/elementfactory.h"
 #include "factory/elementpicturefactory.h"
 #include "projectview.h"
@@ -107,6 +108,12 @@ QETApp::QETApp() :
 	initConfiguration();
 	initLanguage();
 	QET::Icons::initIcons();
+	if (isHeadless()) {
+			//Batch export : projects are loaded and exported
+			//by ProjectBatchExporter, no window is created.
+		initCollectionsCache();
+		return;
+	}
 	initStyle();
 	initSplashScreen();
 	initSystemTray();
@@ -120,12 +127,7 @@ QETApp::QETApp() :
 	setSplashScreenStep(
 		tr("Chargement... Initialisation du cache des collections d'éléments",
 		   "splash screen caption"));
-	if (!collections_cache_) {
-	QString cache_path = QETApp::configDir() + "/elements_cache.sqlite";
-
-		collections_cache_ = new ElementsCollectionCache(cache_path, this);
-		collections_cache_->setLocale(langFromSetting());
-	}
+	initCollectionsCache();
 
 	if (qet_arguments_.files().isEmpty())
 	{
@@ -169,6 +171,7 @@ QETApp::~QETApp()
 
 	ElementFactory::dropInstance();
 	ElementPictureFactory::dropInstance();
+	ElementDefinitionCache::dropInstance();
 	MachineInfo::dropInstance();
 	TerminalStripEditorWindow::dropInstance();
 }
@@ -1965,6 +1968,20 @@ void QETApp::parseArguments()
 	}
 }
 
+/**
+	@brief QETApp::initCollectionsCache
+	Create the cache of the elements collections if it doesn't exist yet
+*/
+void QETApp::initCollectionsCache()
+{
+	if (!collections_cache_) {
+		QString cache_path = QETApp::configDir() + "/elements_cache.sqlite";
+
+		collections_cache_ = new ElementsCollectionCache(cache_path, this);
+		collections_cache_->setLocale(langFromSetting());
+	}
+}
+
 /**
 	@brief QETApp::initSplashScreen
 	Initializes the splash screen if and only if the execution is
@@ -2443,10 +2460,27 @@ void QETApp::printHelp()
 		+ tr("  --config-dir=DIR              Definir le dossier de configuration\n")
 #endif
 		+ tr("  --lang-dir=DIR                Definir le dossier contenant les fichiers de langue\n")
+		+ tr("  --export=FORMAT               Exporter les folios des projets sans interface graphique\n"
+		"                                (pdf, svg, png ou dxf), puis quitter.\n"
+		"                                Les folios sont rendus l'un apres l'autre,\n"
+		"                                seule l'ecriture des fichiers svg et png\n"
+		"                                est faite en parallele\n"
+		"  --out=DIR                     Definir le dossier de destination de l'export\n")
 	);
 	std::cout << qPrintable(help) << std::endl;
 }
 
+/**
+	@brief QETApp::isHeadless
+	@return true if the application was launched to export projects
+	from the command line (option --export) : no window is shown
+	and no question is asked to the user.
+*/
+bool QETApp::isHeadless()
+{
+	return(m_qetapp && m_qetapp->qet_arguments_.exportRequested());
+}
+
 /**
 	@brief QETApp::printVersion
 	Print version to standard output
@@ -72,6 +72,7 @@ class QETApp : public QObject
 		static void printHelp();
 		static void printVersion();
 		static void printLicense();
+		static bool isHeadless();
 		
 		static ElementsCollectionCache *collectionCache();
 		
@@ -173,7 +174,7 @@ class QETApp : public QObject
 		static QETApp *m_qetapp;
 		QTranslator qtTranslator;
 		QTranslator qetTranslator;
-		QSystemTrayIcon *m_qsti;
+		QSystemTrayIcon *m_qsti = nullptr;
 		QSplashScreen *m_splash_screen;
 		QMenu *menu_systray;
 		QAction *quitter_qet;
@@ -268,6 +269,7 @@ class QETApp : public QObject
 		void initLanguage();
 		void initStyle();
 		void initConfiguration();
+		void initCollectionsCache();
 		void initSystemTray();
 		void buildSystemTrayMenu();
 		void checkBackupFiles();
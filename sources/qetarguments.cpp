@@ -65,6 +65,8 @@ common_tbt_dir_(qet_arguments.common_tbt_dir_),
 	config_dir_(qet_arguments.config_dir_),
 #endif
 	lang_dir_(qet_arguments.lang_dir_),
+	export_format_(qet_arguments.export_format_),
+	export_dir_(qet_arguments.export_dir_),
 	print_help_(qet_arguments.print_help_),
 	print_license_(qet_arguments.print_license_),
 	print_version_(qet_arguments.print_version_)
@@ -91,6 +93,8 @@ QETArguments &QETArguments::operator=(const QETArguments &qet_arguments) {
 	config_dir_ = qet_arguments.config_dir_;
 #endif
 	lang_dir_        = qet_arguments.lang_dir_;
+	export_format_   = qet_arguments.export_format_;
+	export_dir_      = qet_arguments.export_dir_;
 	print_help_      = qet_arguments.print_help_;
 	print_license_   = qet_arguments.print_license_;
 	print_version_   = qet_arguments.print_version_;
@@ -190,6 +194,8 @@ void QETArguments::clear()
 #ifdef QET_ALLOW_OVERRIDE_CD_OPTION
 	config_dir_.clear();
 #endif
+	export_format_.clear();
+	export_dir_.clear();
 }
 
 /**
@@ -202,7 +208,16 @@ void QETArguments::parseArguments(const QList<QString> &arguments) {
 	clear();
 	
 	// separe les fichiers des options
-	foreach(QString argument, arguments) {
+	for (int i = 0 ; i < arguments.count() ; ++ i) {
+		const QString &argument = arguments.at(i);
+		
+		// option suivie de sa valeur : "--export pdf", "--out DIR"
+		if (i + 1 < arguments.count()
+			&& handleOptionValue(argument, arguments.at(i + 1))) {
+			++ i;
+			continue;
+		}
+		
 		QFileInfo argument_info(argument);
 		if (argument_info.exists()) {
 		// on exprime les chemins des fichiers en absolu
@@ -240,6 +255,8 @@ void QETArguments::handleFileArgument(const QString &file) {
 	  * --common-tbt-dir
 	  * --config-dir=
 	  * --lang-dir=
+	  * --export=
+	  * --out=
 	  * --help
 	  * --version
 	  * -v
@@ -290,10 +307,41 @@ void QETArguments::handleOptionArgument(const QString &option) {
 		return;
 	}
 	
+	int equal_sign = option.indexOf('=');
+	if (equal_sign != -1
+		&& handleOptionValue(option.left(equal_sign), option.mid(equal_sign + 1))) {
+		return;
+	}
+	
 	// a ce stade, l'option est inconnue
 	unknown_options_ << option;
 }
 
+/**
+	Handle the options which take a value, written either as
+	"--option=value" or as "--option value".
+	The options handled are :
+	  * --export : format of the batch export (pdf, svg, png or dxf)
+	  * --out : destination directory of the batch export
+	@param option : the name of the option, without the "=" sign
+	@param value : the value of the option
+	@return true if option was handled, false otherwise
+*/
+bool QETArguments::handleOptionValue(const QString &option,
+				     const QString &value)
+{
+	if (option == QString("--export")) {
+		export_format_ = value.toLower();
+		options_ << option + "=" + value;
+		return(true);
+	} else if (option == QString("--out")) {
+		export_dir_ = value;
+		options_ << option + "=" + value;
+		return(true);
+	}
+	return(false);
+}
+
 #ifdef QET_ALLOW_OVERRIDE_CED_OPTION
 /**
 	@return true si l'utilisateur a specifie un dossier pour la collection
@@ -396,3 +444,31 @@ bool QETArguments::printVersionRequested() const
 {
 	return(print_version_);
 }
+
+/**
+	@return true if a batch export of the project files was requested
+	with the option --export
+*/
+bool QETArguments::exportRequested() const
+{
+	return(!export_format_.isEmpty());
+}
+
+/**
+	@return the format of the batch export, in lower case
+	(pdf, svg, png or dxf), or an empty string if none were specified.
+	The value is not checked.
+*/
+QString QETArguments::exportFormat() const
+{
+	return(export_format_);
+}
+
+/**
+	@return the destination directory of the batch export
+	or an empty string if none were specified.
+*/
+QString QETArguments::exportDir() const
+{
+	return(export_dir_);
+}
@@ -59,6 +59,9 @@ class QETArguments : public QObject {
 	virtual bool printHelpRequested() const;
 	virtual bool printLicenseRequested() const;
 	virtual bool printVersionRequested() const;
+	virtual bool exportRequested() const;
+	virtual QString exportFormat() const;
+	virtual QString exportDir() const;
 	virtual QList<QString> options() const;
 	virtual QList<QString> unknownOptions() const;
 	
@@ -67,6 +70,7 @@ class QETArguments : public QObject {
 	void parseArguments(const QList<QString> &);
 	void handleFileArgument(const QString &);
 	void handleOptionArgument(const QString &);
+	bool handleOptionValue(const QString &, const QString &);
 	
 	// attributes
 	private:
@@ -85,6 +89,8 @@ class QETArguments : public QObject {
 	QString config_dir_;
 #endif
 	QString lang_dir_;
+	QString export_format_;
+	QString export_dir_;
 	bool print_help_;
 	bool print_license_;
 	bool print_version_;
@@ -30,8 +30,14 @@
 #include "factory/qetgraphicstablefactory.h"
 #include "print/projectprintwindow.h"
 #include "qetgraphicsitem/ViewItem/qetgraphicstableitem.h"
+#include "qetgraphicsitem/conductor.h"
 #include "qetgraphicsitem/conductortextitem.h"
+#include "qetgraphicsitem/diagramimageitem.h"
 #include "qetgraphicsitem/dynamicelementtextitem.h"
+#include "qetgraphicsitem/element.h"
+#include "qetgraphicsitem/elementtextitemgroup.h"
+#include "qetgraphicsitem/independenttextitem.h"
+#include "qetgraphicsitem/qetshapeitem.h"
 #include "qeticons.h"
 #include "qetmessagebox.h"
 #include "recentfiles.h"
@@ -45,6 +51,7 @@
 #include "TerminalStrip/ui/terminalstripeditorwindow.h"
 #include "ui/diagrameditorhandlersizewidget.h"
 #include "TerminalStrip/ui/addterminalstripitemdialog.h"
+#include "TerminalStrip/GraphicsItem/terminalstripitem.h"
 
 #ifdef BUILD_WITHOUT_KF5
 #else
@@ -97,6 +104,11 @@ QETDiagramEditor::QETDiagramEditor(const QStringList &files, QWidget *parent) :
 		//Set the signal mapper
 	connect(&windowMapper, SIGNAL(mapped(QWidget *)), this, SLOT(activateWidget(QWidget *)));
 
+	m_selection_timer.setSingleShot(true);
+	m_selection_timer.setInterval(0);
+	connect(&m_selection_timer, &QTimer::timeout,
+		this, &QETDiagramEditor::updateSelection);
+
 	setWindowTitle(tr("QElectroTech", "window title"));
 	setWindowIcon(QET::Icons::QETLogo);
 	statusBar() -> showMessage(tr("QElectroTech", "status bar message"));
@@ -1287,10 +1299,8 @@ ProjectView *QETDiagramEditor::findProject(DiagramView *diagram_view) const
 ProjectView *QETDiagramEditor::findProject(Diagram *diagram) const
 {
 	foreach(ProjectView *project_view, openedProjects()) {
-		foreach(DiagramView *diagram_view, project_view -> diagram_views()) {
-			if (diagram_view -> diagram() == diagram) {
-				return(project_view);
-			}
+		if (project_view -> project() -> diagrams().contains(diagram)) {
+			return(project_view);
 		}
 	}
 	return(nullptr);
@@ -1621,64 +1631,49 @@ void QETDiagramEditor::slot_updateComplexActions()
 	}
 
 	Diagram *diagram_ = dv->diagram();
-	DiagramContent dc(diagram_);
+	const SelectionSummary selection = summarizeSelection(diagram_->selectedItems());
 	bool ro = diagram_->isReadOnly();
 
 
 	//Number of selected conductors
-	int selected_conductors_count = diagram_->selectedConductors().count();
+	int selected_conductors_count = selection.m_conductors;
 	m_conductor_reset->setEnabled(!ro && selected_conductors_count);
 
 	// number of selected elements
-	int selected_elements_count = dc.count(DiagramContent::Elements);
+	int selected_elements_count = selection.m_elements;
 	m_find_element->setEnabled(selected_elements_count == 1);
 
 	//Action that need items (elements, conductors, texts...) selected, to be enabled
-	bool copiable_items  = dc.hasCopiableItems();
-	bool deletable_items = dc.hasDeletableItems();
-	m_cut              -> setEnabled(!ro && copiable_items);
-	m_copy             -> setEnabled(copiable_items);
-	m_delete_selection -> setEnabled(!ro && deletable_items);
-	m_rotate_selection -> setEnabled(!ro && diagram_->canRotateSelection());
+	m_cut              -> setEnabled(!ro && selection.m_copiable);
+	m_copy             -> setEnabled(selection.m_copiable);
+	m_delete_selection -> setEnabled(!ro && selection.m_deletable);
+	m_rotate_selection -> setEnabled(!ro && selection.m_rotatable);
 
 		//Action that need selected texts or texts group
-	QList<DiagramTextItem *> texts = DiagramContent(diagram_).selectedTexts();
-	QList<ElementTextItemGroup *> groups = DiagramContent(diagram_).selectedTextsGroup();
-	int selected_texts = texts.count();
-	int selected_conductor_texts   = 0;
-	for(DiagramTextItem *dti : texts)
-	{
-		if(dti->type() == ConductorTextItem::Type)
-			selected_conductor_texts++;
-	}
-	int selected_dynamic_elmt_text = 0;
-	for(DiagramTextItem *dti : texts)
-	{
-		if(dti->type() == DynamicElementTextItem::Type)
-			selected_dynamic_elmt_text++;
-	}
-	m_rotate_texts->setEnabled(!ro && (selected_texts || groups.size()));
+	int selected_texts = selection.m_texts;
+	int selected_conductor_texts   = selection.m_conductor_texts;
+	int selected_dynamic_elmt_text = selection.m_element_texts;
+	m_rotate_texts->setEnabled(!ro && (selected_texts || selection.m_texts_groups));
 
 	//Action that need only element text selected
-	QList<DynamicElementTextItem *> deti_list = dc.m_element_texts.values();
-	if(deti_list.size() > 1 && dc.count() == deti_list.count())
-	{
-		Element *elmt = deti_list.first()->parentElement();
-		bool ok = true;
-		for(DynamicElementTextItem *deti : deti_list)
-		{
-			if(elmt != deti->parentElement())
-				ok = false;
-		}
-		m_group_selected_texts->setEnabled(!ro && ok);
-	}
+	int other_selected_items = selection.m_elements
+			+ selection.m_conductors
+			+ (selected_texts
+			   - selected_conductor_texts
+			   - selected_dynamic_elmt_text)
+			+ selection.m_texts_groups
+			+ selection.m_images
+			+ selection.m_shapes
+			+ selection.m_others;
+	if(selected_dynamic_elmt_text > 1 && !other_selected_items)
+		m_group_selected_texts->setEnabled(!ro && selection.m_same_text_parent);
 	else
 		m_group_selected_texts->setDisabled(true);
 
 	// actions need only one editable item
-	int selected_image = dc.count(DiagramContent::Images);
+	int selected_image = selection.m_images;
 
-	int selected_shape = dc.count(DiagramContent::Shapes);
+	int selected_shape = selection.m_shapes;
 	int selected_editable = selected_elements_count
 			+ (selected_texts
 			   - selected_conductor_texts
@@ -1729,14 +1724,91 @@ void QETDiagramEditor::slot_updateComplexActions()
 	}
 
 	//Actions for edit Z value
-	QList<QGraphicsItem *> list = dc.items(
-				DiagramContent::SelectedOnly
-				| DiagramContent::Elements
-				| DiagramContent::Shapes
-				| DiagramContent::Images);
-	m_depth_action_group->setEnabled(list.isEmpty()? false : true);
+	m_depth_action_group->setEnabled(selected_elements_count
+					 || selected_image
+					 || selected_shape);
 }
 
+/**
+	@brief QETDiagramEditor::summarizeSelection
+	Count the selected items by type in one pass,
+	instead of building several DiagramContent.
+	@param selected_items : the selected items of a diagram
+	@return the summary of the selection
+	@see DiagramContent::hasCopiableItems
+	@see DiagramContent::hasDeletableItems
+	@see Diagram::canRotateSelection
+*/
+QETDiagramEditor::SelectionSummary QETDiagramEditor::summarizeSelection(
+		const QList<QGraphicsItem *> &selected_items)
+{
+	SelectionSummary summary;
+	Element *text_parent = nullptr;
+
+	for (QGraphicsItem *qgi : selected_items)
+	{
+		switch (qgi->type())
+		{
+			case Element::Type:
+				++summary.m_elements;
+				summary.m_rotatable = summary.m_deletable = summary.m_copiable = true;
+				break;
+			case Conductor::Type:
+				++summary.m_conductors;
+				summary.m_deletable = true;
+				break;
+			case IndependentTextItem::Type:
+				++summary.m_texts;
+				summary.m_rotatable = summary.m_deletable = summary.m_copiable = true;
+				break;
+			case ConductorTextItem::Type:
+				++summary.m_texts;
+				++summary.m_conductor_texts;
+				summary.m_rotatable = true;
+				break;
+			case DynamicElementTextItem::Type:
+			{
+				++summary.m_texts;
+				++summary.m_element_texts;
+				summary.m_rotatable = summary.m_deletable = true;
+
+				Element *parent = static_cast<DynamicElementTextItem *>(qgi)->parentElement();
+				if (!text_parent) {
+					text_parent = parent;
+				} else if (parent != text_parent) {
+					summary.m_same_text_parent = false;
+				}
+				break;
+			}
+			case DiagramImageItem::Type:
+				++summary.m_images;
+				summary.m_rotatable = summary.m_deletable = summary.m_copiable = true;
+				break;
+			case QetShapeItem::Type:
+				++summary.m_shapes;
+				summary.m_deletable = summary.m_copiable = true;
+				break;
+			case QetGraphicsTableItem::Type:
+			case TerminalStripItem::Type:
+				++summary.m_others;
+				summary.m_deletable = true;
+				break;
+			case QGraphicsItemGroup::Type:
+				if (dynamic_cast<ElementTextItemGroup *>(qgi))
+				{
+					++summary.m_texts_groups;
+					summary.m_rotatable = summary.m_deletable = true;
+				}
+				break;
+			default:
+				break;
+		}
+	}
+
+	return summary;
+}
+
+
 /**
 	@brief QETDiagramEditor::slot_updateModeActions
 	Manage action who need an opened diagram or project to be updated
@@ -2272,7 +2344,9 @@ void QETDiagramEditor::removeDiagramFromProject()
 
 /**
 	@brief QETDiagramEditor::diagramWasAdded
-	Manage the adding of diagram view in a project
+	Manage the adding of diagram view in a project.
+	The views are created when a folio is displayed for the first time,
+	and can be created again for the same diagram.
 	@param dv : added diagram view
 */
 void QETDiagramEditor::diagramWasAdded(DiagramView *dv)
@@ -2281,11 +2355,16 @@ void QETDiagramEditor::diagramWasAdded(DiagramView *dv)
 		&QGraphicsScene::selectionChanged,
 		this,
 		&QETDiagramEditor::selectionChanged,
-		Qt::DirectConnection);
+		Qt::ConnectionType(Qt::DirectConnection | Qt::UniqueConnection));
 	connect(dv,
 		SIGNAL(modeChanged()),
 		this,
 		SLOT(slot_updateModeActions()));
+
+		//The new view of the current project follow the current mode
+	if (m_mode_visualise->isChecked() && findProject(dv) == currentProjectView()) {
+		dv->setVisualisationMode();
+	}
 }
 
 /**
@@ -2332,8 +2411,21 @@ void QETDiagramEditor::subWindowActivated(QMdiSubWindow *subWindows)
 /**
 	@brief QETDiagramEditor::selectionChanged
 	This slot is called when a diagram selection was changed.
+	A rubber band selection change the selection many times,
+	the update is delayed to the next turn of the event loop
+	to be done only one time.
 */
 void QETDiagramEditor::selectionChanged()
+{
+	m_selection_timer.start();
+}
+
+/**
+	@brief QETDiagramEditor::updateSelection
+	Update the actions and the properties editor
+	according to the selection of the current diagram.
+*/
+void QETDiagramEditor::updateSelection()
 {
 	slot_updateComplexActions();
 
@@ -26,6 +26,7 @@
 #include <QDir>
 #include <QMdiArea>
 #include <QSignalMapper>
+#include <QTimer>
 #include <QUndoGroup>
 
 class QMdiSubWindow;
@@ -42,6 +43,7 @@ class RecentFiles;
 class DiagramPropertiesEditorDockWidget;
 class ElementsCollectionWidget;
 class AutoNumberingDockWidget;
+class QGraphicsItem;
 
 #ifdef BUILD_WITHOUT_KF5
 #else
@@ -77,7 +79,28 @@ class QETDiagramEditor : public QETMainWindow
 	  protected:
 		bool event(QEvent *) override;
 	private:
+			///What is selected in a diagram, computed in one pass
+		struct SelectionSummary
+		{
+			int m_elements        = 0;
+			int m_conductors      = 0;
+			int m_texts           = 0; ///independent, conductor and element texts
+			int m_conductor_texts = 0;
+			int m_element_texts   = 0;
+			int m_texts_groups    = 0;
+			int m_images          = 0;
+			int m_shapes          = 0;
+			int m_others          = 0; ///tables and terminal strips
+			bool m_rotatable = false;
+			bool m_deletable = false;
+			bool m_copiable  = false;
+				///true if all selected element texts have the same parent element
+			bool m_same_text_parent = true;
+		};
+
 		QETDiagramEditor(const QETDiagramEditor &);
+		static SelectionSummary summarizeSelection(
+				const QList<QGraphicsItem *> &selected_items);
 		void setUpElementsPanel ();
 		void setUpElementsCollectionWidget();
 		void setUpUndoStack     ();
@@ -146,6 +169,7 @@ class QETDiagramEditor : public QETMainWindow
 
 	private slots:
 		void selectionChanged();
+		void updateSelection();
 
 	public:
 		QAction
@@ -241,5 +265,7 @@ class QETDiagramEditor : public QETMainWindow
 		int activeSubWindowIndex;
 		bool m_first_show = true;
 		SearchAndReplaceWidget m_search_and_replace_widget;
+			///Coalesce the selection changes, one update per event loop turn
+		QTimer m_selection_timer;
 };
 #endif
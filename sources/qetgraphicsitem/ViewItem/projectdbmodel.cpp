@@ -227,6 +227,86 @@ QETProject *ProjectDBModel::project() const
 	return m_project.data();
 }
 
+/**
+	@brief ProjectDBModel::isOutdated
+	@return true if the project data base changed
+	since the records of this model were filled.
+*/
+bool ProjectDBModel::isOutdated() const
+{
+	return m_project
+			&& m_record_generation != m_project->dataBase()->generation();
+}
+
+/**
+	@brief ProjectDBModel::refresh
+	Update the records of this model if they are outdated.
+	The model is reset if the number of rows or columns changed,
+	else dataChanged is emitted once, for the smallest range
+	which contains all the cells which changed.
+*/
+void ProjectDBModel::refresh()
+{
+	if (!isOutdated()) {
+		return;
+	}
+
+	auto original_record = m_record;
+	fillValue();
+	auto new_record = m_record;
+	m_record = original_record;
+
+	auto column_count = [](const QVector<QStringList> &record) {
+		return record.isEmpty() ? 0 : record.first().count();
+	};
+
+	if (new_record.size() != m_record.size()
+		|| column_count(new_record) != column_count(m_record))
+	{
+		emit beginResetModel();
+		m_record = new_record;
+		emit endResetModel();
+		return;
+	}
+
+	m_record = new_record;
+
+		//Bounding range of the changed cells
+	auto first_row = -1, last_row = -1;
+	auto first_col = -1, last_col = -1;
+	for (auto row=0 ; row<m_record.size() ; ++row)
+	{
+		const auto &old_row = original_record.at(row);
+		const auto &new_row = m_record.at(row);
+		if (old_row == new_row) {
+			continue;
+		}
+
+		const auto size = std::max(old_row.size(), new_row.size());
+		for (auto col=0 ; col<size ; ++col)
+		{
+			if (old_row.value(col) != new_row.value(col))
+			{
+				if (first_row == -1) {
+					first_row = row;
+				}
+				last_row = row;
+				if (first_col == -1 || col < first_col) {
+					first_col = col;
+				}
+				last_col = std::max(last_col, col);
+			}
+		}
+	}
+
+	last_col = std::min(last_col, columnCount() - 1);
+	if (first_row != -1 && first_col <= last_col) {
+		emit dataChanged(index(first_row, first_col),
+				 index(last_row, last_col),
+				 QVector<int>(Qt::DisplayRole));
+	}
+}
+
 /**
 	@brief ProjectDBModel::toXml
 	Save the model to xml,since model can have unlimited data we only save few data (only these used by qelectrotech).
@@ -310,28 +390,13 @@ void ProjectDBModel::setIdentifier(const QString &identifier) {
 
 /**
 	@brief ProjectDBModel::dataBaseUpdated
-	slot called when the project database is updated
+	slot called when the project database is updated,
+	the records are not updated here, see refresh.
 */
 void ProjectDBModel::dataBaseUpdated()
 {
-	auto original_record = m_record;
-	fillValue();
-	auto new_record = m_record;
-	m_record = original_record;
-	
-	if (new_record.size() != m_record.size())
-	{
-		emit beginResetModel();
-		m_record = new_record;
-		emit endResetModel();
-	}
-	else
-	{
-		m_record = new_record;
-		auto row = m_record.size();
-		auto col = row ? m_record.first().count() : 1;
-		
-		emit dataChanged(this->index(0,0), this->index(row-1, col-1), QVector<int>(Qt::DisplayRole));
+	if (isOutdated()) {
+		emit outdated();
 	}
 }
 
@@ -359,30 +424,14 @@ void ProjectDBModel::setHeaderString()
 	}
 }
 
+/**
+	@brief ProjectDBModel::fillValue
+	Fill the records with the result of the query,
+	shared with the other models of the project which use the same query.
+*/
 void ProjectDBModel::fillValue()
 {
-	m_record.clear();
-	
-	auto query_ = m_project->dataBase()->newQuery(m_query);
-	if (!query_.exec()) {
-		qDebug() << "Query error : " << query_.lastError();
-	}
-	
-	while (query_.next())
-	{
-		QStringList record_;
-		auto i=0;
-		while (query_.value(i).isValid())
-		{
-			auto date = query_.value(i).toDate();
-			if (!date.isNull()) {
-				record_ << QLocale::system().toString(query_.value(i).toDate(), QLocale::ShortFormat);
-			} else {
-				record_ << query_.value(i).toString();
-			}
-			++i;
-		}
-		m_record << record_;
-	}
+	m_record = m_project->dataBase()->queryRecords(m_query);
+	m_record_generation = m_project->dataBase()->generation();
 }
 
@@ -39,6 +39,10 @@ class QETProject;
 	At the time this sentence is written, there is two identifier :
 	nomenclature
 	summary
+
+	When the project data base is updated the model is only marked as outdated
+	and emit the signal outdated, the records are updated by refresh.
+	This let the views wait until they are displayed to update the model.
 */
 class ProjectDBModel : public QAbstractTableModel
 {
@@ -65,6 +69,8 @@ class ProjectDBModel : public QAbstractTableModel
 		void setQuery(const QString &setQuery);
 		QString queryString() const;
 		QETProject *project() const;
+		bool isOutdated() const;
+		void refresh();
 
 		QDomElement toXml(QDomDocument &document) const;
 		void fromXml(const QDomElement &element);
@@ -72,6 +78,9 @@ class ProjectDBModel : public QAbstractTableModel
 		QString identifier() const {return m_identifier;}
 		static QString xmlTagName() {return QString("project_data_base_model");}
 
+	signals:
+		void outdated();
+
 	private:
 		void dataBaseUpdated();
 		void setHeaderString();
@@ -81,6 +90,8 @@ class ProjectDBModel : public QAbstractTableModel
 		QPointer<QETProject> m_project;
 		QString m_query;
 		QVector<QStringList> m_record;
+			//Generation of the project data base of m_record
+		quint64 m_record_generation = 0;
 		//First int = section, second int = Qt::role, QVariant = value
 		QHash<int, QHash<int, QVariant>> m_header_data;
 		QHash<int, QVariant> m_index_0_0_data;
@@ -177,14 +177,14 @@ void QetGraphicsHeaderItem::paint(
 /**
 	@brief QetGraphicsHeaderItem::toDXF
 	Draw this table to the dxf document
-	@param filepath file path of the the dxf document
+	@param dxf the dxf writer of the document
 	@return true if draw success
 */
-bool QetGraphicsHeaderItem::toDXF(const QString &filepath)
+bool QetGraphicsHeaderItem::toDXF(Createdxf &dxf)
 {
 	QRectF rect = m_current_rect;
 	QPolygonF poly(rect);
-	Createdxf::drawPolygon(filepath,mapToScene(poly),0);
+	dxf.drawPolygon(mapToScene(poly),0);
 
 	//Draw vertical lines
 	auto offset= 0;
@@ -192,9 +192,7 @@ bool QetGraphicsHeaderItem::toDXF(const QString &filepath)
 	{
 		QPointF p1(offset+size, m_current_rect.top());
 		QPointF p2(offset+size, m_current_rect.bottom());
-		Createdxf::drawLine(
-					filepath,
-					QLineF(
+		dxf.drawLine(QLineF(
 						mapToScene(p1),
 						mapToScene(p2)),
 					0);
@@ -214,16 +212,14 @@ bool QetGraphicsHeaderItem::toDXF(const QString &filepath)
 			   m_section_height - margins_.top() - margins_.bottom());
 
 		QPointF qm = mapToScene(top_left);
-		qreal h = size.height();//  * Createdxf::yScale;
-		qreal x = qm.x() * Createdxf::xScale;
-		qreal y = Createdxf::sheetHeight -  ((qm.y() + h/2) * Createdxf::yScale);
-		qreal h1 = h * 0.5 * Createdxf::yScale;
+		qreal h = size.height();//  * dxf.yScale();
+		qreal x = qm.x() * dxf.xScale();
+		qreal y = Createdxf::sheetHeight -  ((qm.y() + h/2) * dxf.yScale());
+		qreal h1 = h * 0.5 * dxf.yScale();
 
 		int valign = 2;
 
-		Createdxf::drawTextAligned(
-					filepath,
-					m_model->headerData(
+		dxf.drawTextAligned(m_model->headerData(
 						i,
 						Qt::Horizontal,
 						Qt::DisplayRole).toString(),
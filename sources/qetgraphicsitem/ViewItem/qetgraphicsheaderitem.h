@@ -25,6 +25,7 @@
 #include <QMargins>
 
 class QAbstractItemModel;
+class Createdxf;
 
 /**
 	@brief The QetGraphicsHeaderItem class
@@ -66,7 +67,7 @@ class QetGraphicsHeaderItem : public QGraphicsObject
 		QDomElement toXml (QDomDocument &document) const;
 		void fromXml(const QDomElement &element);
 		static QString xmlTagName() {return QString("graphics_header");}
-		virtual bool toDXF (const QString &filepath);
+		virtual bool toDXF (Createdxf &dxf);
 
 	signals:
 		void sectionResized(int logicalIndex, int size);
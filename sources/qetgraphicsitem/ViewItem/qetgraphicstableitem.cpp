@@ -30,7 +30,12 @@
 #include <QFontMetrics>
 #include <QGraphicsScene>
 #include <QGraphicsSceneMouseEvent>
+#include <QGraphicsView>
 #include <QPainter>
+#include <QStyle>
+#include <QStyleOptionGraphicsItem>
+
+#include <cmath>
 
 static int no_model_height = 20;
 static int no_model_width = 40;
@@ -133,6 +138,8 @@ QetGraphicsTableItem::QetGraphicsTableItem(QGraphicsItem *parent) :
 {
 	setFlag(QGraphicsItem::ItemIsMovable, true);
 	setFlag(QGraphicsItem::ItemIsSelectable, true);
+		//Needed to only paint the exposed rows
+	setFlag(QGraphicsItem::ItemUsesExtendedStyleOption, true);
 	setAcceptHoverEvents(true);
 	setUpHandler();
 
@@ -157,6 +164,12 @@ QetGraphicsTableItem::QetGraphicsTableItem(QGraphicsItem *parent) :
 
 QetGraphicsTableItem::~QetGraphicsTableItem()
 {
+		//Deleted while still in the diagram
+		//(for example by removeUselessNextTable)
+	if (Diagram *diagram_ = diagram()) {
+		diagram_->unregisterItem(this);
+	}
+
 	if (m_previous_table) {
 		if (m_next_table) {
 			m_previous_table->setNextTable(m_next_table);
@@ -183,10 +196,15 @@ void QetGraphicsTableItem::setModel(QAbstractItemModel *model)
 			   this, &QetGraphicsTableItem::dataChanged);
 		disconnect(m_model, &QAbstractItemModel::modelReset,
 			   this, &QetGraphicsTableItem::modelReseted);
+		if (auto db_model = qobject_cast<ProjectDBModel *>(m_model.data())) {
+			disconnect(db_model, &ProjectDBModel::outdated,
+				   this, &QetGraphicsTableItem::modelOutdated);
+		}
 	}
 	m_model = model;
 	m_header_item->setModel(m_model);
 
+	setUpStyle();
 	setUpColumnAndRowMinimumSize();
 	adjustSize();
 
@@ -197,6 +215,10 @@ void QetGraphicsTableItem::setModel(QAbstractItemModel *model)
 			this, &QetGraphicsTableItem::dataChanged);
 		connect(m_model, &QAbstractItemModel::modelReset,
 			this, &QetGraphicsTableItem::modelReseted);
+		if (auto db_model = qobject_cast<ProjectDBModel *>(m_model.data())) {
+			connect(db_model, &ProjectDBModel::outdated,
+				this, &QetGraphicsTableItem::modelOutdated);
+		}
 	}
 
 	if (m_next_table) {
@@ -213,6 +235,20 @@ QAbstractItemModel *QetGraphicsTableItem::model() const
 	return m_model.data();
 }
 
+/**
+	@brief QetGraphicsTableItem::refreshModel
+	If the model is a ProjectDBModel, update it if it is outdated.
+	Must be called before the table is displayed or exported,
+	because an outdated model is not updated while the table is not displayed.
+	@see Diagram::refreshTables
+*/
+void QetGraphicsTableItem::refreshModel()
+{
+	if (auto db_model = qobject_cast<ProjectDBModel *>(m_model.data())) {
+		db_model->refresh();
+	}
+}
+
 /**
 	@brief QetGraphicsTableItem::boundingRect
 	Reimplemented from QGraphicsObject
@@ -235,7 +271,6 @@ void QetGraphicsTableItem::paint(
 		const QStyleOptionGraphicsItem *option,
 		QWidget *widget)
 {
-	Q_UNUSED(option)
 	Q_UNUSED(widget)
 
 	painter->save();
@@ -262,11 +297,13 @@ void QetGraphicsTableItem::paint(
 		painter->restore();
 		return;
 	}
-	painter->setFont(m_model->data(m_model->index(0,0), Qt::FontRole).value<QFont>());
+	painter->setFont(m_font);
+
+	const auto column_count = m_model->columnCount();
 
 		//Draw vertical lines
 	auto offset= 0;
-	for(auto i=0 ; i<m_model->columnCount() ; ++i)
+	for(auto i=0 ; i<column_count ; ++i)
 	{
 		QPointF p1(offset+m_header_item->sectionSize(i), 0);
 		QPointF p2(offset+m_header_item->sectionSize(i), m_current_size.height());
@@ -283,46 +320,128 @@ void QetGraphicsTableItem::paint(
 	if (m_number_of_row_to_display > 0) //User override the number of row to display
 		row_count = std::min(row_count, m_number_of_row_to_display);
 
-		//Draw horizontal lines
+	if (row_count <= 0)
+	{
+		painter->restore();
+		return;
+	}
+
+		//Only the rows in the exposed rect are drawn
 	auto cell_height =  static_cast<double>(m_current_size.height())/static_cast<double>(row_count);
-	for(auto i= 1 ; i-1<row_count ; ++i)
+	const auto first_row = std::max(0, static_cast<int>(std::floor(option->exposedRect.top()/cell_height)));
+	const auto last_row = std::min(row_count-1, static_cast<int>(std::floor(option->exposedRect.bottom()/cell_height)));
+
+		//Draw horizontal lines
+	for(auto i= first_row+1 ; i-1<=last_row ; ++i)
 	{
 		QPointF p1(m_header_item->rect().left(), cell_height*i);
 		QPointF p2(m_header_item->rect().right(), cell_height*i);
 		painter->drawLine(p1, p2);
 	}
 
-		//Write text of each cell
-	for (auto i=0 ; i<row_count ; ++i)
+		//Write text of each cell, aligned like QPainter::drawText
+	const auto text_height = static_cast<int>(cell_height) - m_margins.top() - m_margins.bottom();
+	const auto alignment = QStyle::visualAlignment(painter->layoutDirection(),
+						       Qt::Alignment(m_text_alignment) | Qt::AlignVCenter);
+	for (auto i=first_row ; i<=last_row ; ++i)
 	{
-		auto margin_ = QETUtils::marginsFromString(m_model->index(0,0).data(Qt::UserRole+1).toString());
-		QPointF top_left(margin_.left(), i==0? margin_.top() : cell_height*i + margin_.top());
+		const auto &texts = cellsText(i);
+		auto left = m_margins.left();
+		const auto top = cell_height*i + m_margins.top();
 
-		for(auto j= 0 ; j<m_model->columnCount() ; ++j)
+		for(auto j= 0 ; j<column_count && j<texts.size() ; ++j)
 		{
-				//In first iteration the top left X is margin left,
-				// in all other iteration the top left X is stored in m_column_size
 			if (j>0) {
-				top_left.setX(top_left.x() + m_header_item->sectionSize(j-1));
+				left += m_header_item->sectionSize(j-1);
+			}
+			const auto &text = texts.at(j);
+			const auto text_size = text.size();
+			const auto width = m_header_item->sectionSize(j) - m_margins.left() - m_margins.right();
+
+			auto x = static_cast<qreal>(left);
+			if (alignment & Qt::AlignRight) {
+				x += width - text_size.width();
+			} else if (alignment & Qt::AlignHCenter) {
+				x += (width - text_size.width())/2;
+			}
+			auto y = top;
+			if (alignment & Qt::AlignBottom) {
+				y += text_height - text_size.height();
+			} else if (alignment & Qt::AlignVCenter) {
+				y += (text_height - text_size.height())/2;
+			}
+
+				//A text bigger than its cell is clipped to the cell
+			if (text_size.width() > width || text_size.height() > text_height)
+			{
+				painter->save();
+				painter->setClipRect(QRectF(left, top, width, text_height), Qt::IntersectClip);
+				painter->drawStaticText(QPointF(x, y), text);
+				painter->restore();
+			} else {
+				painter->drawStaticText(QPointF(x, y), text);
 			}
-			QSize size(m_header_item->sectionSize(j) - margin_.left() - margin_.right(),
-					   static_cast<int>(cell_height) - margin_.top() - margin_.bottom());
-			auto index_row = m_previous_table ? i + m_previous_table->displayNRowOffset() : i;
-			painter->drawText(
-						QRectF(top_left, size),
-						m_model->data(
-							m_model->index(0,0),
-							Qt::TextAlignmentRole
-							).toInt()
-						| Qt::AlignVCenter,
-						m_model->index(index_row, j)
-						.data().toString());
 		}
 	}
 
 	painter->restore();
 }
 
+/**
+	@brief QetGraphicsTableItem::setUpStyle
+	Read the font, the text alignment and the margins of the table
+	in the index 0,0 of the model.
+	The text already laid out is cleared.
+*/
+void QetGraphicsTableItem::setUpStyle()
+{
+	m_cells_text.clear();
+	if (!m_model) {
+		return;
+	}
+
+	const auto index = m_model->index(0,0);
+	m_font = m_model->data(index, Qt::FontRole).value<QFont>();
+	m_text_alignment = m_model->data(index, Qt::TextAlignmentRole).toInt();
+	m_margins = QETUtils::marginsFromString(index.data(Qt::UserRole+1).toString());
+}
+
+/**
+	@brief QetGraphicsTableItem::cellsText
+	@param row : displayed row of this table (the rows displayed
+	by the previous tables are not counted).
+	@return the text of each cell of row, laid out with the font of the table.
+	The text is laid out the first time a row is requested.
+*/
+const QVector<QStaticText> &QetGraphicsTableItem::cellsText(int row)
+{
+	const auto offset = m_previous_table ? m_previous_table->displayNRowOffset() : 0;
+	if (offset != m_cells_text_offset)
+	{
+		m_cells_text.clear();
+		m_cells_text_offset = offset;
+	}
+	if (m_cells_text.size() <= row) {
+		m_cells_text.resize(row+1);
+	}
+
+	auto &texts = m_cells_text[row];
+	if (texts.isEmpty())
+	{
+		const auto column_count = m_model->columnCount();
+		texts.reserve(column_count);
+		for (auto col=0 ; col<column_count ; ++col)
+		{
+			QStaticText text(m_model->index(row + offset, col).data().toString());
+			text.setTextFormat(Qt::PlainText);
+			text.setPerformanceHint(QStaticText::AggressiveCaching);
+			text.prepare(QTransform(), m_font);
+			texts << text;
+		}
+	}
+	return texts;
+}
+
 /**
 	@brief QetGraphicsTableItem::setSize
 	Set the current size of the table to size
@@ -677,18 +796,18 @@ void QetGraphicsTableItem::fromXml(const QDomElement &dom_element)
 /**
 	@brief QetGraphicsTableItem::toDXF
 	Draw this table to the dxf document
-	@param filepath file path of the the dxf document
+	@param dxf the dxf writer of the document
 	@return true if draw success
 */
-bool QetGraphicsTableItem::toDXF(const QString &filepath)
+bool QetGraphicsTableItem::toDXF(Createdxf &dxf)
 {
 	// Header
-	m_header_item->toDXF(filepath);
+	m_header_item->toDXF(dxf);
 
 	//QRectF rect = boundingRect();
 	QRectF rect(0,0, m_header_item->rect().width(), m_current_size.height());
 	QPolygonF poly(rect);
-	Createdxf::drawPolygon(filepath,mapToScene(poly),0);
+	dxf.drawPolygon(mapToScene(poly),0);
 
 	//Draw vertical lines
 	auto offset= 0;
@@ -698,9 +817,7 @@ bool QetGraphicsTableItem::toDXF(const QString &filepath)
 		QPointF p2(
 					offset+m_header_item->sectionSize(i),
 					m_current_size.height());
-		Createdxf::drawLine(
-					filepath,
-					QLineF(mapToScene(p1),mapToScene(p2)),
+		dxf.drawLine(QLineF(mapToScene(p1),mapToScene(p2)),
 					0);
 		offset += m_header_item->sectionSize(i);
 	}
@@ -719,9 +836,7 @@ bool QetGraphicsTableItem::toDXF(const QString &filepath)
 	{
 		QPointF p1(m_header_item->rect().left(), cell_height*i);
 		QPointF p2(m_header_item->rect().right(), cell_height*i);
-		Createdxf::drawLine(
-					filepath,
-					QLineF(mapToScene(p1),mapToScene(p2))
+		dxf.drawLine(QLineF(mapToScene(p1),mapToScene(p2))
 					,0);
 	}
 
@@ -743,16 +858,14 @@ bool QetGraphicsTableItem::toDXF(const QString &filepath)
 			auto index_row = m_previous_table ? i + m_previous_table->displayNRowOffset() : i;
 
 			QPointF qm = mapToScene(top_left);
-			qreal h = size.height();//  * Createdxf::yScale;
-			qreal x = qm.x() * Createdxf::xScale;
-			qreal y = Createdxf::sheetHeight -  ((qm.y() + h/2) * Createdxf::yScale);
-			qreal h1 = h * 0.5 * Createdxf::yScale;
+			qreal h = size.height();//  * dxf.yScale();
+			qreal x = qm.x() * dxf.xScale();
+			qreal y = Createdxf::sheetHeight -  ((qm.y() + h/2) * dxf.yScale());
+			qreal h1 = h * 0.5 * dxf.yScale();
 
 			int valign = 2;
 
-			Createdxf::drawTextAligned(
-						filepath,
-						m_model->index(index_row, j).data().toString(),
+			dxf.drawTextAligned(m_model->index(index_row, j).data().toString(),
 						x,y,h1,0,0,0,valign,x,0,0);
 		}
 	}
@@ -841,6 +954,38 @@ QVariant QetGraphicsTableItem::itemChange(
 	return QetGraphicsItem::itemChange(change, value);
 }
 
+/**
+	@brief QetGraphicsTableItem::modelOutdated
+	The project data base changed, update the model now
+	only if the table is displayed, else the update is
+	done by refreshModel when the table is displayed or exported.
+*/
+void QetGraphicsTableItem::modelOutdated()
+{
+	if (isDisplayed()) {
+		refreshModel();
+	}
+}
+
+/**
+	@brief QetGraphicsTableItem::isDisplayed
+	@return true if the scene of this table is displayed by a visible view
+*/
+bool QetGraphicsTableItem::isDisplayed() const
+{
+	if (!scene()) {
+		return false;
+	}
+
+	const auto views = scene()->views();
+	for (auto view : views) {
+		if (view->isVisible()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 /**
  * @brief QetGraphicsTableItem::modelReseted
  */
@@ -870,8 +1015,8 @@ void QetGraphicsTableItem::setUpColumnAndRowMinimumSize()
 		return;
 	}
 
-	QFontMetrics metrics(m_model->data(model()->index(0,0), Qt::FontRole).value<QFont>());
-	auto margin_ = QETUtils::marginsFromString(model()->index(0,0).data(Qt::UserRole+1).toString());
+	QFontMetrics metrics(m_font);
+	const auto &margin_ = m_margins;
 		//Set the height of row;
 	m_minimum_row_height = metrics.boundingRect("HEIGHT TEST").height() + margin_.top() + margin_.bottom();
 
@@ -1041,6 +1186,7 @@ void QetGraphicsTableItem::dataChanged(
 	Q_UNUSED(bottomRight)
 	Q_UNUSED(roles)
 
+	setUpStyle();
 	setUpColumnAndRowMinimumSize();
 	adjustSize();
 	update();
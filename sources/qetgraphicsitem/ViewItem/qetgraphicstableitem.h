@@ -23,8 +23,11 @@
 #include "../../qetgraphicsitem/qetgraphicsitem.h"
 
 #include <QFont>
+#include <QMargins>
+#include <QStaticText>
 
 class QAbstractItemModel;
+class Createdxf;
 class QetGraphicsHeaderItem;
 
 /**
@@ -61,6 +64,7 @@ class QetGraphicsTableItem : public QetGraphicsItem
 
 		void setModel(QAbstractItemModel *model = nullptr);
 		QAbstractItemModel *model() const;
+		void refreshModel();
 
 		virtual QRectF boundingRect() const override;
 		virtual void paint(
@@ -90,7 +94,7 @@ class QetGraphicsTableItem : public QetGraphicsItem
 		QDomElement toXml(QDomDocument &dom_document) const;
 		void fromXml(const QDomElement &dom_element);
 		static QString xmlTagName() {return QString("graphics_table");}
-		virtual bool toDXF (const QString &filepath);
+		virtual bool toDXF (Createdxf &dxf);
 
 	protected:
 		virtual void hoverEnterEvent(
@@ -106,6 +110,10 @@ class QetGraphicsTableItem : public QetGraphicsItem
 
 	private:
 		void modelReseted();
+		void modelOutdated();
+		bool isDisplayed() const;
+		void setUpStyle();
+		const QVector<QStaticText> &cellsText(int row);
 		void setUpColumnAndRowMinimumSize();
 		void setUpBoundingRect();
 		void adjustHandlerPos();
@@ -125,6 +133,17 @@ class QetGraphicsTableItem : public QetGraphicsItem
 
 		QPointer<QAbstractItemModel> m_model;
 
+			//Style of the table, read from the index 0,0 of the model
+		QFont m_font;
+		int m_text_alignment = Qt::AlignLeft;
+		QMargins m_margins;
+
+			//Text of each displayed row laid out once,
+			//a row is laid out when painted for the first time.
+			//Cleared when the data of the model change.
+		QVector<QVector<QStaticText>> m_cells_text;
+		int m_cells_text_offset = 0;
+
 		QVector<int> m_minimum_column_width;
 		int
 		m_minimum_row_height,
@@ -24,6 +24,7 @@
 #include "../conductorsegmentprofile.h"
 #include "../diagram.h"
 #include "../diagramcommands.h"
+#include "../potentialindex.h"
 #include "../qetdiagrameditor.h"
 #include "../qetgraphicsitem/terminal.h"
 #include "../ui/conductorpropertiesdialog.h"
@@ -139,6 +140,10 @@ Conductor::Conductor(Terminal *p1, Terminal* p2) :
 */
 Conductor::~Conductor()
 {
+		//Deleted while still in the diagram
+	if (Diagram *diagram_ = diagram()) {
+		diagram_->unregisterItem(this);
+	}
 	removeHandler();
 	terminal1->removeConductor(this);
 	terminal2->removeConductor(this);
@@ -720,6 +725,9 @@ QVariant Conductor::itemChange(GraphicsItemChange change, const QVariant &value)
 	else if (change == QGraphicsItem::ItemPositionHasChanged && isSelected()) {
 		adjusteHandlerPos();
 	}
+	else if (change == QGraphicsItem::ItemScenePositionHasChanged) {
+		invalidateJunctions();
+	}
 
 	return(QGraphicsObject::itemChange(change, value));
 }
@@ -1529,7 +1537,7 @@ void Conductor::setPath(const QPainterPath &path)
 
 	prepareGeometryChange();
 	m_path = path;
-	update();
+	invalidateJunctions();
 }
 
 QPainterPath Conductor::path() const
@@ -1684,63 +1692,23 @@ void Conductor::displayedTextChanged()
 	@brief Conductor::relatedPotentialConductors
 	Return all conductors at the same potential of this conductor,
 	this conductor isn't part of the returned QSet.
+	The potentials are read from the potential index of the project,
+	@see PotentialIndex
 	@param all_diagram : if true search in all diagram of the project,
 	false search only in the parent diagram of this conductor
-	@param t_list : a list of terminal already found for this potential.
 	@return  a QSet of conductor at the same potential.
 */
-QSet<Conductor *> Conductor::relatedPotentialConductors(const bool all_diagram, QList <Terminal *> *t_list)
+QSet<Conductor *> Conductor::relatedPotentialConductors(const bool all_diagram)
 {
-	bool declar_t_list = false;
-	if (t_list == nullptr)
-	{
-		declar_t_list = true;
-		t_list = new QList <Terminal *>;
+	PotentialIndex *index = PotentialIndex::indexOf(terminal1);
+	if (!index) {
+		index = PotentialIndex::indexOf(terminal2);
 	}
-
-	QSet <Conductor *> other_conductors;
-	QList <Terminal *> this_terminal;
-	this_terminal << terminal1 << terminal2;
-
-		// Return all conductors of terminal 1 and 2
-	for (Terminal *terminal : this_terminal)
-	{
-		if (!t_list->contains(terminal))
-		{
-			t_list->append(terminal);
-			QList <Conductor *> other_conductors_list_t = terminal->conductors();
-
-				//Get the other terminals of the parent element of @terminal, who share the same potential
-				//This is use for element type "folio report" and "terminal element"
-			for (Terminal *t : relatedPotentialTerminal(terminal, all_diagram))
-			{
-				if (!t_list->contains(t))
-				{
-					t_list -> append(t);
-					other_conductors_list_t += t->conductors();
-				}
-			}
-
-			other_conductors_list_t.removeAll(this);
-				//Get the conductors at the same potential for each conductors of other_conductors_list_t
-			for (Conductor *c : other_conductors_list_t) {
-				other_conductors += c->relatedPotentialConductors(all_diagram, t_list);
-			}
-#if QT_VERSION < QT_VERSION_CHECK(5, 14, 0)	// ### Qt 6: remove
-			other_conductors += other_conductors_list_t.toSet();
-#else
-#if TODO_LIST
-#pragma message("@TODO remove code for QT 5.14 or later")
-#endif
-			other_conductors += QSet<Conductor*>(other_conductors_list_t.begin(),other_conductors_list_t.end());
-#endif
-		}
+	if (index) {
+		return index->conductors(this, all_diagram);
 	}
 
-	other_conductors.remove(this);
-
-	if (declar_t_list) delete t_list;
-	return(other_conductors);
+	return PotentialIndex::search(this, all_diagram);
 }
 
 /**
@@ -1822,8 +1790,51 @@ bool isContained(const QPointF &a, const QPointF &b, const QPointF &c) {
 
 /**
 	@return la liste des positions des jonctions avec d'autres conducteurs
+	The junctions are computed at the first call after invalidateJunctions()
+	and kept until the next one, so the paint doesn't compute them again.
 */
 QList<QPointF> Conductor::junctions() const
+{
+	if (!m_junctions_valid)
+	{
+		m_junctions = computeJunctions();
+		m_junctions_valid = true;
+	}
+	return(m_junctions);
+}
+
+/**
+	@brief Conductor::invalidateJunctions
+	Forget the junctions of this conductor and of the conductors which share
+	a terminal with it, they are computed again when they are painted.
+	Must be called when the path or the connections of this conductor change.
+*/
+void Conductor::invalidateJunctions()
+{
+	m_junctions_valid = false;
+	update();
+
+	if (!terminal1 || !terminal2) {
+		return;
+	}
+
+	for (Conductor *c : relatedConductors(this))
+	{
+		if (c->m_junctions_valid)
+		{
+			c->m_junctions_valid = false;
+			c->update();
+		}
+	}
+}
+
+/**
+	@brief Conductor::computeJunctions
+	A bend of this conductor is a junction when it is on a segment
+	of a related conductor, which doesn't have the same bend at this point.
+	@return the positions of the junctions, in local coordinates
+*/
+QList<QPointF> Conductor::computeJunctions() const
 {
 	QList<QPointF> junctions_list;
 
@@ -1834,54 +1845,64 @@ QList<QPointF> Conductor::junctions() const
 		return(junctions_list);
 	}
 
-	QList<QPointF> points = segmentsToPoints();
-	for (int i = 1 ; i < (points.size() -1) ; ++ i) {
-		QPointF point = points.at(i);
+		//Segments and bends of the other conductors are mapped
+		//to the scene once, instead of once per bend of this conductor
+	struct OtherConductor
+	{
+		QVector<QPair<QPointF, QPointF>> m_segments;
+		QList<ConductorBend> m_bends;
+	};
+	QVector<OtherConductor> others;
+	others.reserve(other_conductors.size());
+	for (Conductor *c : other_conductors)
+	{
+		OtherConductor other;
+		for (ConductorSegment *segment : c->segmentsList()) {
+			other.m_segments << qMakePair(c->mapToScene(segment->firstPoint()),
+						      c->mapToScene(segment->secondPoint()));
+		}
+		if (other.m_segments.isEmpty()) {
+			continue;
+		}
+		other.m_bends = c->bends();
+		for (ConductorBend &cb : other.m_bends) {
+			cb.first = c->mapToScene(cb.first);
+		}
+		others << other;
+	}
 
-		// determine si le point est une bifurcation ou non
-		bool is_bend = false;
-		Qt::Corner current_bend_type = Qt::TopLeftCorner;
-		foreach(ConductorBend cb, bends_list)
+	for (const ConductorBend &bend : qAsConst(bends_list))
+	{
+		const QPointF scene_point = mapToScene(bend.first);
+		for (const OtherConductor &other : qAsConst(others))
 		{
-			if (cb.first == point)
+			bool on_segment = false;
+			for (const auto &segment : other.m_segments)
 			{
-				is_bend = true;
-				current_bend_type = cb.second;
-				break;
+				if (isContained(scene_point, segment.first, segment.second))
+				{
+					on_segment = true;
+					break;
+				}
 			}
-		}
-		// si le point n'est pas une bifurcation, il ne peut etre une jonction (enfin pas au niveau de ce conducteur)
-		if (!is_bend) continue;
-
-		bool is_junction = false;
-		QPointF scene_point = mapToScene(point);
-		foreach(Conductor *c, other_conductors)
-		{
-				// exprime le point dans les coordonnees de l'autre conducteur
-			QPointF conductor_point = c -> mapFromScene(scene_point);
-				// recupere les segments de l'autre conducteur
-			QList<ConductorSegment *> c_segments = c -> segmentsList();
-			if (c_segments.isEmpty())
+			if (!on_segment) {
 				continue;
-				// parcoure les segments a la recherche d'un point commun
-			for (int j = 0 ; j < c_segments.count() ; ++ j)
+			}
+
+				//The common point must not be the same bend on the other conductor
+			bool same_bend = false;
+			for (const ConductorBend &cb : other.m_bends)
 			{
-				ConductorSegment *segment = c_segments[j];
-					// un point commun a ete trouve sur ce segment
-				if (isContained(conductor_point, segment -> firstPoint(), segment -> secondPoint()))
+				if (cb.first == scene_point && cb.second == bend.second)
 				{
-					is_junction = true;
-					// ce point commun ne doit pas etre une bifurcation identique a celle-ci
-					QList<ConductorBend> other_conductor_bends = c -> bends();
-					foreach(ConductorBend cb, other_conductor_bends)
-					{
-						if (cb.first == conductor_point && cb.second == current_bend_type)
-						{
-							is_junction = false;
-						}
-					}
+					same_bend = true;
+					break;
 				}
-				if (is_junction) junctions_list << point;
+			}
+			if (!same_bend)
+			{
+				junctions_list << bend.first;
+				break;
 			}
 		}
 	}
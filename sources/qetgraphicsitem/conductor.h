@@ -126,8 +126,7 @@ class Conductor : public QGraphicsObject
 		virtual Highlight highlight() const;
 		virtual void setHighlighted(Highlight);
 		QSet<Conductor *> relatedPotentialConductors(
-				const bool all_diagram = true,
-				QList <Terminal *> *t_list=nullptr);
+				const bool all_diagram = true);
 		QETDiagramEditor* diagramEditor() const;
 		void editProperty ();
 
@@ -138,6 +137,7 @@ class Conductor : public QGraphicsObject
 		void setSequenceNum(const autonum::sequentialNumbers& sn);
 
 		QList<QPointF> junctions() const;
+		void invalidateJunctions();
 
 	private:
 		void setUpConnectionForFormula(
@@ -211,6 +211,9 @@ class Conductor : public QGraphicsObject
 		static QBrush conductor_brush;
 		static bool pen_and_brush_initialized;
 		QPainterPath m_path;
+			/// Junctions with the related conductors, computed when needed
+		mutable QList<QPointF> m_junctions;
+		mutable bool m_junctions_valid = false;
 	
 	private:
 		void segmentsToPath();
@@ -220,6 +223,7 @@ class Conductor : public QGraphicsObject
 		uint segmentsCount(QET::ConductorSegmentType = QET::Both) const;
 		QList<QPointF> segmentsToPoints() const;
 		QList<ConductorBend> bends() const;
+		QList<QPointF> computeJunctions() const;
 
 		void pointsToSegments(const QList<QPointF>&);
 		Qt::Corner currentPathType() const;
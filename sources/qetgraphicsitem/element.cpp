@@ -24,6 +24,7 @@
 #include "../diagramcontext.h"
 #include "../diagramposition.h"
 #include "../elementprovider.h"
+#include "../factory/elementdefinitioncache.h"
 #include "../factory/elementpicturefactory.h"
 #include "../properties/terminaldata.h"
 #include "../qetgraphicsitem/conductor.h"
@@ -100,7 +101,7 @@ Element::Element(
 		}
 	}
 	int elmt_state;
-	buildFromXml(location.xml(), &elmt_state);
+	buildFromXml(ElementDefinitionCache::instance()->definition(location), &elmt_state);
 	if (state) {
 		*state = elmt_state;
 	}
@@ -133,6 +134,10 @@ Element::Element(
 */
 Element::~Element()
 {
+		//Deleted while still in the diagram
+	if (Diagram *diagram_ = diagram()) {
+		diagram_->unregisterItem(this);
+	}
 	qDeleteAll (m_dynamic_text_list);
 	qDeleteAll (m_terminals);
 }
@@ -775,7 +780,11 @@ bool Element::fromXml(QDomElement &e,
 		qDebug()<<"Help code for QT 6 or later";
 #endif
 	//uuid of this element
+	const QUuid old_uuid = m_uuid;
 	m_uuid = QUuid(e.attribute(QStringLiteral("uuid"), QUuid::createUuid().toString()));
+	if (m_uuid != old_uuid && diagram()) {
+		diagram()->elementUuidChanged(this, old_uuid);
+	}
 
 		//load prefix
 	m_prefix = e.attribute(QStringLiteral("prefix"));
@@ -1303,6 +1312,25 @@ void Element::initLink(QETProject *prj)
 	tmp_uuids_link.clear();
 }
 
+/**
+	@brief Element::linkPendingElements
+	Same as initLink, but the elements to be linked are found
+	in elements instead of searching them in each diagram of the project.
+	@param elements : all elements of the project, by uuid
+	@see QETProject::linkPendingElements
+*/
+void Element::linkPendingElements(const QHash<QUuid, Element *> &elements)
+{
+	if (tmp_uuids_link.isEmpty()) return;
+
+	for (const QUuid &uuid : qAsConst(tmp_uuids_link)) {
+		if (Element *elmt = elements.value(uuid)) {
+			elmt->linkToElement(this);
+		}
+	}
+	tmp_uuids_link.clear();
+}
+
 /**
  * @brief Element::linkTypeToString
  * \deprecated use instead ElementData::typeToString
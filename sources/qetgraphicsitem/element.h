@@ -175,6 +175,7 @@ class Element : public QetGraphicsItem
 		virtual void unlinkAllElements() {}
 		virtual void unlinkElement(Element *) {}
 		virtual void initLink(QETProject *);
+		void linkPendingElements(const QHash<QUuid, Element *> &elements);
 		QList<Element *> linkedElements ();
 
 		/**
@@ -49,6 +49,10 @@ IndependentTextItem::IndependentTextItem(const QString &text) :
 /// Destructeur
 IndependentTextItem::~IndependentTextItem()
 {
+		//Deleted while still in the diagram
+	if (Diagram *diagram_ = diagram()) {
+		diagram_->unregisterItem(this);
+	}
 }
 
 /**
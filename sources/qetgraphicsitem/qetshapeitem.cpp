@@ -942,38 +942,35 @@ QDomElement QetShapeItem::toXml(QDomDocument &document) const
 /**
 	@brief QetShapeItem::toDXF
 	Draw this element to the dxf document
-	@param filepath file path of the the dxf document
+	@param dxf the dxf writer of the document
 	@param pen
 	@return true if draw success
 */
-bool QetShapeItem::toDXF(const QString &filepath,const QPen &pen)
+bool QetShapeItem::toDXF(Createdxf &dxf,const QPen &pen)
 {
 
 	switch (m_shapeType)
 	{
 		case Line:
-			Createdxf::drawLine(filepath,
-			QLineF( mapToScene(m_P1),
+			dxf.drawLine(QLineF( mapToScene(m_P1),
 				mapToScene(m_P2)),
 				Createdxf::dxfColor(pen));
 			return true;
 		case Rectangle:
-			Createdxf::drawRectangle(filepath,
-			QRectF(mapToScene(m_P1),
+			dxf.drawRectangle(QRectF(mapToScene(m_P1),
 				mapToScene(m_P2)).normalized(),
 				Createdxf::dxfColor(pen));
 			return true;
 		case Ellipse:
-			Createdxf::drawEllipse(filepath,
-			QRectF(mapToScene(m_P1),
+			dxf.drawEllipse(QRectF(mapToScene(m_P1),
 				mapToScene(m_P2)).normalized(),
 				Createdxf::dxfColor(pen));
 			return true;
 		case Polygon:
 			if(m_polygon.isClosed())
-				Createdxf::drawPolygon(filepath,m_polygon,Createdxf::dxfColor(pen));
+				dxf.drawPolygon(m_polygon,Createdxf::dxfColor(pen));
 			else
-				Createdxf::drawPolyline(filepath,m_polygon,Createdxf::dxfColor(pen));
+				dxf.drawPolyline(m_polygon,Createdxf::dxfColor(pen));
 			return true;
 		default:
 			return false;
@@ -27,6 +27,7 @@ class QDomElement;
 class QDomDocument;
 class QetGraphicsHandlerItem;
 class QAction;
+class Createdxf;
 
 /**
 	@brief The QetShapeItem class
@@ -83,7 +84,7 @@ class QetShapeItem : public QetGraphicsItem
 
 		virtual bool	    fromXml (const QDomElement &);
 		virtual QDomElement toXml (QDomDocument &document) const;
-		virtual bool toDXF (const QString &filepath,const QPen &pen);
+		virtual bool toDXF (Createdxf &dxf,const QPen &pen);
 
 		void editProperty() override;
 		QString name() const override;
@@ -28,7 +28,15 @@ ReportElement::ReportElement(const ElementsLocation &location, const QString& li
 	Element(location, qgi, state,
 			link_type == "next_report"? Element::NextReport : Element::PreviousReport),
 	m_inverse_report(link_type == "next_report"? Element::PreviousReport : Element::NextReport)
-{}
+{
+		//The potentials of the project change with the link of this report
+	connect(this, &Element::linkedElementChanged, this, [this]()
+	{
+		if (diagram() && diagram()->project()) {
+			diagram()->project()->potentialIndex()->linksChanged(this);
+		}
+	});
+}
 
 /**
 	@brief ReportElement::~ReportElement
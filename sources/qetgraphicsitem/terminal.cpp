@@ -19,6 +19,7 @@
 
 #include "../conductorautonumerotation.h"
 #include "../diagram.h"
+#include "../potentialindex.h"
 #include "../undocommand/addgraphicsobjectcommand.h"
 #include "../properties/terminaldata.h"
 #include "../qetgraphicsitem/conductor.h"
@@ -134,6 +135,10 @@ bool Terminal::addConductor(Conductor *conductor)
 			return false; //They already a conductor linked to this and other_terminal
 
 	m_conductors_list.append(conductor);
+	if (PotentialIndex *index = PotentialIndex::indexOf(this)) {
+		index->conductorAdded(conductor);
+	}
+	conductor->invalidateJunctions();
 	emit conductorWasAdded(conductor);
 	return(true);
 }
@@ -148,6 +153,10 @@ void Terminal::removeConductor(Conductor *conductor)
 	int index = m_conductors_list.indexOf(conductor);
 	if (index == -1) return;
 	m_conductors_list.removeAt(index);
+	if (PotentialIndex *potential_index = PotentialIndex::indexOf(this)) {
+		potential_index->conductorRemoved(conductor);
+	}
+	conductor->invalidateJunctions();
 	emit conductorWasRemoved(conductor);
 }
 
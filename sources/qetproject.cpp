@@ -23,7 +23,9 @@
 #include "autoNum/numerotationcontext.h"
 #include "autoNum/numerotationcontextcommands.h"
 #include "diagram.h"
+#include "factory/elementdefinitioncache.h"
 #include "qetapp.h"
+#include "qetgraphicsitem/element.h"
 #include "qetmessagebox.h"
 #include "qetresult.h"
 #include "titleblock/integrationmovetemplateshandler.h"
@@ -31,17 +33,35 @@
 #include "titleblocktemplate.h"
 #include "ui/dialogwaiting.h"
 #include "ui/importelementdialog.h"
+#include "undocommand/diagramsundocommand.h"
 #include "TerminalStrip/terminalstrip.h"
 #include "qetxml.h"
 #include "qetversion.h"
 
+#include <QElapsedTimer>
+#include <QFutureWatcher>
 #include <QHash>
 #include <QStandardPaths>
+#include <QThread>
 #include <QTimer>
 #include <QtConcurrent>
 #include <QtDebug>
+#include <QXmlStreamReader>
 #include <utility>
 
+namespace {
+	/**
+		@brief backupFoliosPlaceholder
+		@return the text of the comment written in place of the folios
+		in the backup document, replaced by the xml of each folio
+		when the backup file is written.
+	*/
+	inline QString backupFoliosPlaceholder()
+	{
+		return QStringLiteral("qet-backup-folios");
+	}
+}
+
 static int BACKUP_INTERVAL = 120000; //interval in ms of backup = 2min
 
 /**
@@ -53,6 +73,7 @@ QETProject::QETProject(QObject *parent) :
 	QObject              (parent),
 	m_titleblocks_collection(this),
 	m_data_base(this, this),
+	m_potential_index(this),
 	m_project_properties_handler{this}
 {
 	setDefaultTitleBlockProperties(TitleBlockProperties::defaultProperties());
@@ -76,6 +97,7 @@ QETProject::QETProject(const QString &path, QObject *parent) :
 	QObject              (parent),
 	m_titleblocks_collection(this),
 	m_data_base(this, this),
+	m_potential_index(this),
 	m_project_properties_handler{this}
 {
 	QFile file(path);
@@ -98,6 +120,7 @@ QETProject::QETProject(KAutoSaveFile *backup, QObject *parent) :
 	QObject              (parent),
 	m_titleblocks_collection(this),
 	m_data_base(this, this),
+	m_potential_index(this),
 	m_project_properties_handler{this}
 {
 	m_state = openFile(backup);
@@ -131,9 +154,14 @@ QETProject::QETProject(KAutoSaveFile *backup, QObject *parent) :
 */
 QETProject::~QETProject()
 {
+		//The backup file must not be written anymore when it is deleted
+	m_backup_watcher.waitForFinished();
+
 		//We block database signal to avoid hundreds of unnecessary emitted signal
 		//due to deletion (diagram, item, etc...) and as much update made in the not yet deleted things.
 	m_data_base.blockSignals(true);
+		//The potentials are not walked again for each deleted element
+	m_potential_index.invalidate();
 
 		//Each time a diagram is deleted we also remove it from m_diagram_list
 		//because a lot of thing append during the destructor of a diagram class
@@ -148,6 +176,8 @@ QETProject::~QETProject()
 		delete  diagram;
 		m_diagrams_list.removeOne(diagram);
 	}
+
+	ElementDefinitionCache::instance()->removeProject(this);
 }
 
 /**
@@ -159,6 +189,15 @@ projectDataBase *QETProject::dataBase()
 	return &m_data_base;
 }
 
+/**
+	@brief QETProject::potentialIndex
+	@return The index of the potentials of this project
+*/
+PotentialIndex *QETProject::potentialIndex()
+{
+	return &m_potential_index;
+}
+
 /**
 	@brief QETProject::uuid
 	@return the uuid of this project
@@ -178,9 +217,11 @@ void QETProject::init()
 
 	m_undo_stack = new QUndoStack(this);
 	connect(m_undo_stack, SIGNAL(cleanChanged(bool)), this, SLOT(undoStackChanged(bool)));
+	connect(m_undo_stack, &QUndoStack::indexChanged, this, &QETProject::invalidateChangedFoliosBackup);
 
 	m_save_backup_timer.setInterval(BACKUP_INTERVAL);
 	connect(&m_save_backup_timer, &QTimer::timeout, this, &QETProject::writeBackup);
+	connect(&m_backup_watcher, &QFutureWatcher<qint64>::finished, this, &QETProject::backupWritten);
 	m_save_backup_timer.start();
 	writeBackup();
 
@@ -215,9 +256,57 @@ QETProject::ProjectState QETProject::openFile(QFile *file)
 	QFileInfo fi(*file);
 	setFilePath(fi.absoluteFilePath());
 
-		//Extract the content of the xml
+	QElapsedTimer timer;
+	timer.start();
+
+		//Read the content of the xml with a stream reader.
+		//The diagrams are the biggest part of a project, they are kept
+		//as raw xml and each of them is converted to dom only when
+		//the diagram is built. The embedded collection is parsed
+		//in its own document, which is given as is to the collection.
+		//The other parts are stored in xml_project.
 	QDomDocument xml_project;
-	if (!xml_project.setContent(file))
+	QDomDocument collection_xml;
+	QVector<QByteArray> diagrams_xml;
+	QSet<QString> elements_types;
+	QXmlStreamReader reader(file);
+	if (reader.readNextStartElement())
+	{
+		QDomElement root = xml_project.createElement(reader.name().toString());
+		for (const auto &attribute : reader.attributes()) {
+			root.setAttribute(attribute.name().toString(),
+					  attribute.value().toString());
+		}
+		xml_project.appendChild(root);
+
+		while (reader.readNextStartElement())
+		{
+			if (reader.name() == QLatin1String("diagram"))
+			{
+				diagrams_xml << QETXML::readCurrentElement(reader,
+									   [&elements_types](const QXmlStreamReader &r)
+				{
+					if (r.name() == QLatin1String("element")
+						&& r.attributes().hasAttribute(QStringLiteral("type"))) {
+						elements_types.insert(r.attributes().value(QStringLiteral("type")).toString());
+					}
+				});
+			}
+			else if (reader.name() == QLatin1String("collection")
+				 && collection_xml.isNull())
+			{
+				collection_xml.setContent(QETXML::readCurrentElement(reader));
+			}
+			else
+			{
+				QDomDocument child_document;
+				child_document.setContent(QETXML::readCurrentElement(reader));
+				root.appendChild(xml_project.importNode(child_document.documentElement(), true));
+			}
+		}
+	}
+
+	if (reader.hasError() || xml_project.documentElement().isNull())
 	{
 		if(opened_here) {
 			file->close();
@@ -226,7 +315,9 @@ QETProject::ProjectState QETProject::openFile(QFile *file)
 	}
 
 		//Build the project from the xml
-	readProjectXml(xml_project);
+	readProjectXml(xml_project, collection_xml, diagrams_xml, elements_types);
+	qInfo() << "Project" << fi.fileName() << "loaded in" << timer.elapsed() << "ms,"
+		<< "links between elements resolved in" << m_links_resolution_time << "ms";
 
 	if (!fi.isWritable()) {
 		setReadOnly(true);
@@ -333,6 +424,7 @@ void QETProject::setFilePath(const QString &filepath)
 	}
 #ifdef BUILD_WITHOUT_KF5
 #else
+	m_backup_watcher.waitForFinished();
 	if (m_backup_file.isOpen()) {
 		m_backup_file.close();
 	}
@@ -915,6 +1007,17 @@ void QETProject::autoFolioNumberingSelectedFolios(int from,
 	@return un document XML representant le projet
 */
 QDomDocument QETProject::toXml()
+{
+	return(projectXml(true));
+}
+
+/**
+	@brief QETProject::projectXml
+	@param with_diagrams : if false the diagrams are not written,
+	a comment backupFoliosPlaceholder() is written at their place.
+	@return un document XML representant le projet
+*/
+QDomDocument QETProject::projectXml(bool with_diagrams)
 {
 	// racine du projet
 	QDomDocument xml_doc;
@@ -950,22 +1053,27 @@ QDomDocument QETProject::toXml()
 	project_root.appendChild(new_diagrams_properties);
 
 	// schemas
-
-	qDebug() << "Export XML de" << m_diagrams_list.count() << "schemas";
-	int order_num = 1;
-	const QList<Diagram *> diagrams_list = m_diagrams_list;
-	for(Diagram *diagram : diagrams_list)
+	if (!with_diagrams) {
+		project_root.appendChild(xml_doc.createComment(backupFoliosPlaceholder()));
+	}
+	else
 	{
-		qDebug() << QString("exporting diagram \"%1\""
-					).arg(diagram -> title())
-			 << "["
-			 << diagram
-			 << "]";
-		QDomElement xml_diagram = diagram->toXml().documentElement();
-		QDomNode xml_node = xml_doc.importNode(xml_diagram, true);
-
-		QDomNode appended_diagram = project_root.appendChild(xml_node);
-		appended_diagram.toElement().setAttribute("order", order_num ++);
+		qDebug() << "Export XML de" << m_diagrams_list.count() << "schemas";
+		int order_num = 1;
+		const QList<Diagram *> diagrams_list = m_diagrams_list;
+		for(Diagram *diagram : diagrams_list)
+		{
+			qDebug() << QString("exporting diagram \"%1\""
+						).arg(diagram -> title())
+				 << "["
+				 << diagram
+				 << "]";
+			QDomElement xml_diagram = diagram->toXml().documentElement();
+			QDomNode xml_node = xml_doc.importNode(xml_diagram, true);
+
+			QDomNode appended_diagram = project_root.appendChild(xml_node);
+			appended_diagram.toElement().setAttribute("order", order_num ++);
+		}
 	}
 
 		//Write terminal strip to xml
@@ -1297,6 +1405,9 @@ void QETProject::removeDiagram(Diagram *diagram)
 
 	if (m_diagrams_list.removeAll(diagram))
 	{
+			//The index is built again without the removed diagram
+			//instead of removing its elements one by one
+		m_potential_index.invalidate();
 		emit diagramRemoved(this, diagram);
 		diagram->deleteLater();
 	}
@@ -1338,9 +1449,17 @@ void QETProject::setModified(bool modified) {
 /**
 	@brief QETProject::readProjectXml
 	Read and make the project from an xml description
-	@param xml_project : the description of the project from an xml
-*/
-void QETProject::readProjectXml(QDomDocument &xml_project)
+	@param xml_project : the description of the project from an xml,
+	without the diagrams and the embedded collection
+	@param collection_xml : the embedded collection of the project,
+	can be null
+	@param diagrams_xml : the raw xml of each diagram of the project
+	@param elements_types : the types of all elements used by the diagrams
+*/
+void QETProject::readProjectXml(QDomDocument &xml_project,
+				QDomDocument &collection_xml,
+				QVector<QByteArray> &diagrams_xml,
+				const QSet<QString> &elements_types)
 {
 	QDomElement root_elmt = xml_project.documentElement();
 	m_state = ProjectParsingRunning;
@@ -1352,7 +1471,10 @@ void QETProject::readProjectXml(QDomDocument &xml_project)
 		m_project_qet_version = QetVersion::fromXmlAttribute(root_elmt);
 		if (!m_project_qet_version.isNull())
 		{
-			if (QetVersion::currentVersion() < m_project_qet_version)
+				//No question can be asked in headless mode,
+				//the project is opened as if the user accepted.
+			if (QetVersion::currentVersion() < m_project_qet_version
+				&& !QETApp::isHeadless())
 			{
 				int ret = QET::QetMessageBox::warning(
 							nullptr,
@@ -1379,7 +1501,8 @@ void QETProject::readProjectXml(QDomDocument &xml_project)
 
 				//Since QElectrotech 0.9 the compatibility with project made with
 				//Qet 0.6 or lower is break;
-			if (m_project_qet_version <= QetVersion::versionZeroDotSix())
+			if (m_project_qet_version <= QetVersion::versionZeroDotSix()
+				&& !QETApp::isHeadless())
 			{
 				auto ret = QET::QetMessageBox::warning(
 							nullptr,
@@ -1421,10 +1544,13 @@ void QETProject::readProjectXml(QDomDocument &xml_project)
 	m_titleblocks_collection.fromXml(xml_project.documentElement());
 
 		//Load the embedded elements collection
-	readElementsCollectionXml(xml_project);
+	readElementsCollectionXml(xml_project, collection_xml);
 
 		//Load the diagrams
-	readDiagramsXml(xml_project);
+	readDiagramsXml(diagrams_xml, elements_types);
+
+		//Link the elements together, before refresh the diagrams
+	linkPendingElements();
 
 		//Load the terminal strip
 	readTerminalStripXml(xml_project);
@@ -1439,13 +1565,46 @@ void QETProject::readProjectXml(QDomDocument &xml_project)
 	m_state = Ok;
 }
 
+/**
+	@brief QETProject::linkPendingElements
+	Resolve in one pass the links between the elements of all diagrams
+	read from the xml : the elements are hashed once by uuid,
+	instead of searching each linked uuid in every diagram.
+	The elements linked here have nothing left to link
+	when the diagrams are refreshed.
+	@see Element::initLink
+*/
+void QETProject::linkPendingElements()
+{
+	QElapsedTimer timer;
+	timer.start();
+
+	QHash<QUuid, Element *> elements;
+	for (Diagram *diagram : qAsConst(m_diagrams_list)) {
+		for (Element *element : diagram->elements()) {
+			elements.insert(element->uuid(), element);
+		}
+	}
+
+	for (Diagram *diagram : qAsConst(m_diagrams_list)) {
+		for (Element *element : diagram->elements()) {
+			element->linkPendingElements(elements);
+		}
+	}
+
+	m_links_resolution_time = timer.elapsed();
+}
+
 /**
 	@brief QETProject::readDiagramsXml
-	Load the diagrams from the xml description of the project.
+	Load the diagrams from their raw xml description.
 	Note a project can have 0 diagram
-	@param xml_project
+	@param diagrams_xml : the raw xml of each diagram,
+	each entry is cleared once the diagram is built.
+	@param elements_types : the types of all elements used by the diagrams
 */
-void QETProject::readDiagramsXml(QDomDocument &xml_project)
+void QETProject::readDiagramsXml(QVector<QByteArray> &diagrams_xml,
+				 const QSet<QString> &elements_types)
 {
 #if TODO_LIST
 #pragma message("@TODO try to solve a weird bug (dialog is black) since port to Qt5 with the DialogWaiting")
@@ -1458,28 +1617,29 @@ void QETProject::readDiagramsXml(QDomDocument &xml_project)
 		dlgWaiting = DialogWaiting::instance();
 		dlgWaiting -> setModal(true);
 		dlgWaiting -> show();
-		dlgWaiting -> setTitle(tr("<p align=\"center\">"
-					  "<b>Ouverture du projet en cours...</b><br/>"
-					  "Création des folios"
-					  "</p>"));
 	}
 
-	//Search the diagrams in the project
-	QDomNodeList diagram_nodes = xml_project.elementsByTagName(QStringLiteral("diagram"));
+	preloadElementsDefinitions(elements_types);
 
 	if(dlgWaiting)
-		dlgWaiting->setProgressBarRange(0, diagram_nodes.length()*3);
+	{
+		dlgWaiting->setTitle(tr("<p align=\"center\">"
+					"<b>Ouverture du projet en cours...</b><br/>"
+					"Création des folios"
+					"</p>"));
+		dlgWaiting->setProgressBarRange(0, diagrams_xml.size()*3);
+		dlgWaiting->setProgressBar(0);
+	}
 
-	for (int i = 0 ; i < diagram_nodes.length() ; ++ i)
+	for (int i = 0 ; i < diagrams_xml.size() ; ++ i)
 	{
 		if(dlgWaiting)
 			dlgWaiting->setProgressBar(i+1);
 
-		if (diagram_nodes.at(i).isElement())
+		QDomDocument diagram_document;
+		if (diagram_document.setContent(diagrams_xml.at(i)))
 		{
-			QDomElement diagram_xml_element = diagram_nodes
-					.at(i)
-					.toElement();
+			QDomElement diagram_xml_element = diagram_document.documentElement();
 			auto diagram = new Diagram(this);
 			m_diagrams_list << diagram;
 
@@ -1492,6 +1652,8 @@ void QETProject::readDiagramsXml(QDomDocument &xml_project)
 			if(dlgWaiting)
 				dlgWaiting->setDetail(diagram->title());
 		}
+			//The raw xml of this diagram is no longer needed
+		diagrams_xml[i].clear();
 	}
 
 	updateDiagramsFolioData();
@@ -1507,13 +1669,95 @@ void QETProject::readDiagramsXml(QDomDocument &xml_project)
 	}
 }
 
+/**
+	@brief QETProject::preloadElementsDefinitions
+	Parse the definition of every element type used by the diagrams
+	of this project, before the diagrams are built.
+	The elements of the file system collections are read
+	on a pool of threads, the elements of the embedded collection are read
+	in the current thread because the dom of the project is not thread safe.
+	Like that, the creation of the elements (which must be done in the gui thread)
+	only use definitions already stored in the ElementDefinitionCache.
+	@param types : the types (paths) of the elements to read
+*/
+void QETProject::preloadElementsDefinitions(const QSet<QString> &types)
+{
+	QList<ElementsLocation> file_locations;
+	for (const auto &type : qAsConst(types))
+	{
+		if (type.startsWith(QStringLiteral("embed://")))
+		{
+			ElementsLocation location(type, this);
+			ElementDefinitionCache::instance()->definition(location);
+			location.uuid();
+		}
+		else
+		{
+			ElementsLocation location(type);
+			if (location.isElement()) {
+				file_locations << location;
+			}
+		}
+	}
+
+	if (file_locations.isEmpty()) {
+		return;
+	}
+
+	DialogWaiting *dlgWaiting = nullptr;
+	if (DialogWaiting::hasInstance())
+	{
+		dlgWaiting = DialogWaiting::instance();
+		dlgWaiting->setTitle(tr("<p align=\"center\">"
+					"<b>Ouverture du projet en cours...</b><br/>"
+					"Lecture des éléments"
+					"</p>"));
+		dlgWaiting->setProgressBarRange(0, file_locations.size());
+	}
+
+		//The elements are read by batches and the progress is updated
+		//between two batches, like it is done for the folios,
+		//instead of running an event loop while the project is half built.
+		//The backup and autosave timers are only started by init(),
+		//once the project is loaded.
+	const int batch_size = qMax(QThread::idealThreadCount() * 8,
+				    file_locations.size() / 20);
+	for (int i = 0 ; i < file_locations.size() ; i += batch_size)
+	{
+		QtConcurrent::blockingMap(file_locations.begin() + i,
+					  file_locations.begin() + qMin(i + batch_size, file_locations.size()),
+					  [](const ElementsLocation &location)
+		{
+			ElementDefinitionCache::instance()->definition(location);
+			location.uuid();
+		});
+
+		if (dlgWaiting) {
+			dlgWaiting->setProgressBar(qMin(i + batch_size, file_locations.size()));
+		}
+	}
+}
+
 /**
 	@brief QETProject::readElementsCollectionXml
-	Load the diagrams from the xml description of the project
+	Load the embedded elements collection of the project
 	@param xml_project : the xml description of the project
+	@param collection_xml : the embedded collection already
+	read in its own document, if null the collection is searched
+	in xml_project
 */
-void QETProject::readElementsCollectionXml(QDomDocument &xml_project)
+void QETProject::readElementsCollectionXml(QDomDocument &xml_project,
+					   QDomDocument &collection_xml)
 {
+		//The collection was read in its own document,
+		//the collection use it without copy.
+	if (!collection_xml.documentElement().isNull())
+	{
+		m_elements_collection = new XmlElementCollection(collection_xml, this);
+		collection_xml.clear();
+		return;
+	}
+
 		//Get the embedded elements collection of the project
 	QDomNodeList collection_roots = xml_project.elementsByTagName(QStringLiteral("collection"));
 	QDomElement collection_root;
@@ -1530,6 +1774,9 @@ void QETProject::readElementsCollectionXml(QDomDocument &xml_project)
 		//Read the collection
 	else {
 		m_elements_collection = new XmlElementCollection(collection_root, this);
+			//The collection keep its own copy of the xml,
+			//free the copy of xml_project which can be huge.
+		collection_root.parentNode().removeChild(collection_root);
 	}
 }
 
@@ -1905,26 +2152,144 @@ NamesList QETProject::namesListForIntegrationCategory()
 
 /**
 	@brief QETProject::writeBackup
-	Write a backup file of this project, in the case that QET crash
+	Write a backup file of this project, in the case that QET crash.
+	Only the folios which may have changed since the last backup
+	are serialized, in the GUI thread.
+	The assembly of the project and the writing of the file
+	are done in a worker thread.
+	@see lastBackupGuiTime
+	@see lastBackupWriteTime
 */
 void QETProject::writeBackup()
 {
 #ifdef BUILD_WITHOUT_KF5
 #else
-#	if QT_VERSION < QT_VERSION_CHECK(6, 0, 0) // ### Qt 6: remove
-	QDomDocument xml_project(toXml());
-	QtConcurrent::run(
-				QET::writeToFile,xml_project,&m_backup_file,nullptr);
-#	else
-#		if TODO_LIST
-#			pragma message("@TODO remove code for QT 6 or later")
-#		endif
-	qDebug() << "Help code for QT 6 or later"
-			 << "QtConcurrent::run its backwards now...function, object, args";
-#	endif
+		//The previous backup is still being written
+	if (m_backup_watcher.isRunning()) {
+		return;
+	}
+
+	QElapsedTimer timer;
+	timer.start();
+
+	const QDomDocument xml_project(projectXml(false));
+
+	QStringList folios_xml;
+	QHash<Diagram *, BackupFolio> backup_folios;
+	int order_num = 1;
+	for (Diagram *diagram : qAsConst(m_diagrams_list))
+	{
+		BackupFolio folio = m_backup_folios.value(diagram);
+		if (diagram->m_backup_dirty
+			|| folio.m_order != order_num
+			|| !m_backup_folios.contains(diagram))
+		{
+			diagram->m_backup_dirty = false;
+			QDomElement xml_diagram = diagram->toXml().documentElement();
+			xml_diagram.setAttribute("order", order_num);
+
+			folio.m_xml.clear();
+			QTextStream stream(&folio.m_xml);
+			xml_diagram.save(stream, 4);
+			folio.m_order = order_num;
+		}
+
+		folios_xml << folio.m_xml;
+		backup_folios.insert(diagram, folio);
+		++order_num;
+	}
+		//Removed folios are forgotten
+	m_backup_folios.swap(backup_folios);
+
+	m_backup_gui_time = timer.elapsed();
+
+	QFile *file = &m_backup_file;
+	m_backup_watcher.setFuture(QtConcurrent::run([xml_project, folios_xml, file]() -> qint64
+	{
+		QElapsedTimer timer;
+		timer.start();
+
+		QString xml = xml_project.toString(4);
+		xml.replace(QStringLiteral("<!--%1-->").arg(backupFoliosPlaceholder()),
+			    folios_xml.join(QString()));
+
+		if (!file->isOpen() && !file->open(QIODevice::WriteOnly)) {
+			return -1;
+		}
+		const QByteArray data = xml.toUtf8();
+		file->seek(0);
+		const bool written = file->write(data) == data.size();
+		file->resize(data.size());
+		file->flush();
+
+		return written ? timer.elapsed() : -1;
+	}));
 #endif
 }
 
+/**
+	@brief QETProject::backupWritten
+	Called when the worker thread has written the backup file
+*/
+void QETProject::backupWritten()
+{
+	m_backup_write_time = m_backup_watcher.result();
+	qInfo() << "Backup of" << title() << "written,"
+		<< m_backup_gui_time << "ms in the GUI thread,"
+		<< m_backup_write_time << "ms in the worker thread";
+}
+
+/**
+	@brief QETProject::invalidateChangedFoliosBackup
+	Called when the index of the undo stack changed.
+	The folios changed by the commands done or undone since the last
+	call are serialized again by the next backup. If a command
+	doesn't know the folios it changes, every folio is serialized again.
+	@param index : the new index of the undo stack
+*/
+void QETProject::invalidateChangedFoliosBackup(int index)
+{
+	int first = qMin(m_backup_undo_index, index);
+	const int last = qMax(m_backup_undo_index, index);
+	m_backup_undo_index = index;
+		//Same index : the last command was merged with a new one,
+		//or the oldest command was removed by the undo limit
+	if (first == last) {
+		--first;
+	}
+
+	QSet<Diagram *> diagrams;
+	bool known = true;
+	for (int i = qMax(first, 0) ; known && i < qMin(last, m_undo_stack->count()) ; ++i) {
+		known = DiagramsUndoCommand::changedDiagrams(m_undo_stack->command(i), diagrams);
+	}
+
+	for (Diagram *diagram : qAsConst(m_diagrams_list)) {
+		if (!known || diagrams.contains(diagram)) {
+			diagram->invalidateBackup();
+		}
+	}
+}
+
+/**
+	@brief QETProject::lastBackupGuiTime
+	@return the time in ms spent in the GUI thread by the last backup
+*/
+qint64 QETProject::lastBackupGuiTime() const
+{
+	return m_backup_gui_time;
+}
+
+/**
+	@brief QETProject::lastBackupWriteTime
+	@return the time in ms spent in the worker thread
+	to write the last backup, -1 if the file can't be written.
+*/
+qint64 QETProject::lastBackupWriteTime() const
+{
+	return m_backup_write_time;
+}
+
 /**
 	@return true if project options (title, project-wide properties, settings
 	for new diagrams, diagrams order...) were modified, false otherwise.
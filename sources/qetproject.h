@@ -24,6 +24,7 @@
 #include "borderproperties.h"
 #include "conductorproperties.h"
 #include "dataBase/projectdatabase.h"
+#include "potentialindex.h"
 #include "properties/reportproperties.h"
 #include "properties/xrefproperties.h"
 #include "titleblock/templatescollection.h"
@@ -34,7 +35,9 @@
 #	include <KAutoSaveFile>
 #endif
 
+#include <QFutureWatcher>
 #include <QHash>
+#include <QSet>
 
 class Diagram;
 class ElementsLocation;
@@ -91,6 +94,7 @@ class QETProject : public QObject
 	public:
 		ProjectPropertiesHandler& projectPropertiesHandler();
 		projectDataBase *dataBase();
+		PotentialIndex *potentialIndex();
 		QUuid uuid() const;
 		ProjectState state() const;
 		QList<Diagram *> diagrams() const;
@@ -166,6 +170,8 @@ class QETProject : public QObject
 		void autoFolioNumberingSelectedFolios(int, int, const QString&);
 
 		QDomDocument toXml();
+		qint64 lastBackupGuiTime() const;
+		qint64 lastBackupWriteTime() const;
 		bool close();
 		QETResult write();
 		bool isReadOnly() const;
@@ -224,18 +230,28 @@ class QETProject : public QObject
 		void undoStackChanged (bool a) {if (!a) setModified(true);}
 
 	private:
-		void readProjectXml(QDomDocument &xml_project);
-		void readDiagramsXml(QDomDocument &xml_project);
-		void readElementsCollectionXml(QDomDocument &xml_project);
+		void readProjectXml(QDomDocument &xml_project,
+				    QDomDocument &collection_xml,
+				    QVector<QByteArray> &diagrams_xml,
+				    const QSet<QString> &elements_types);
+		void readDiagramsXml(QVector<QByteArray> &diagrams_xml,
+				     const QSet<QString> &elements_types);
+		void preloadElementsDefinitions(const QSet<QString> &types);
+		void linkPendingElements();
+		void readElementsCollectionXml(QDomDocument &xml_project,
+					       QDomDocument &collection_xml);
 		void readProjectPropertiesXml(QDomDocument &xml_project);
 		void readDefaultPropertiesXml(QDomDocument &xml_project);
 		void readTerminalStripXml(const QDomDocument &xml_project);
 
+		QDomDocument projectXml(bool with_diagrams);
 		void writeProjectPropertiesXml(QDomElement &);
 		void writeDefaultPropertiesXml(QDomElement &);
 		void addDiagram(Diagram *diagram, int pos = -1);
 		NamesList namesListForIntegrationCategory();
 		void writeBackup();
+		void backupWritten();
+		void invalidateChangedFoliosBackup(int index);
 		void init();
 		ProjectState openFile(QFile *file);
 		void refresh();
@@ -292,8 +308,24 @@ class QETProject : public QObject
 #else
 		KAutoSaveFile m_backup_file;
 #endif
+			/// Serialized xml of each folio, kept between two backups
+		struct BackupFolio
+		{
+			QString m_xml;
+			int m_order = 0;
+		};
+		QHash<Diagram *, BackupFolio> m_backup_folios;
+			/// Write the backup file in a worker thread, give the write time in ms
+		QFutureWatcher<qint64> m_backup_watcher;
+		qint64 m_backup_gui_time = 0;
+		qint64 m_backup_write_time = 0;
+			/// Index of the undo stack when the changed folios were last checked
+		int m_backup_undo_index = 0;
+			/// Time in ms of the links resolution of the last load
+		qint64 m_links_resolution_time = 0;
 		QUuid m_uuid = QUuid::createUuid();
 		projectDataBase m_data_base;
+		PotentialIndex m_potential_index;
 		QVector<TerminalStrip *> m_terminal_strip_vector;
 
 		ProjectPropertiesHandler m_project_properties_handler;
@@ -23,6 +23,8 @@
 #include <QFont>
 #include <QGraphicsItem>
 #include <QPen>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
 
 /**
 	@brief QETXML::penToXml
@@ -583,6 +585,55 @@ QVector<QDomElement> QETXML::findInDomElement(const QDomElement &dom_elmt, const
 	return(return_list);
 }
 
+/**
+ * @brief QETXML::readCurrentElement
+ * Copy the element at the current position of \p reader,
+ * with all its children, to a byte array.
+ * The current token of \p reader must be a start element,
+ * when this function return, the current token of \p reader is the
+ * matching end element.
+ * Use this function to keep a part of a big xml file as raw xml
+ * and only build a QDomDocument of this part when needed.
+ * @param reader : the xml stream to read
+ * @param start_element_visitor : optional function called
+ * for each start element copied (the current element included).
+ * @return the xml of the current element, if the stream is malformed
+ * the returned xml is truncated and \p reader has an error.
+ */
+QByteArray QETXML::readCurrentElement(
+		QXmlStreamReader &reader,
+		const std::function<void(const QXmlStreamReader &)> &start_element_visitor)
+{
+	QByteArray data;
+	if (!reader.isStartElement()) {
+		return data;
+	}
+
+	QXmlStreamWriter writer(&data);
+	int depth = 0;
+	while (!reader.hasError())
+	{
+		if (reader.isStartElement())
+		{
+			++depth;
+			if (start_element_visitor) {
+				start_element_visitor(reader);
+			}
+		}
+		else if (reader.isEndElement()) {
+			--depth;
+		}
+
+		writer.writeCurrentToken(reader);
+		if (depth == 0 || reader.atEnd()) {
+			break;
+		}
+		reader.readNext();
+	}
+
+	return data;
+}
+
 namespace QETXML {
 
 /**
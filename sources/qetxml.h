@@ -21,11 +21,14 @@
 #include <QDomElement>
 #include <QPen>
 
+#include <functional>
+
 class QDomDocument;
 class QDir;
 class QFile;
 class QAbstractItemModel;
 class QGraphicsItem;
+class QXmlStreamReader;
 
 /**
  *This namespace contain some function to use xml with QET.
@@ -91,6 +94,10 @@ namespace QETXML
 	QVector<QDomElement> findInDomElement(const QDomElement &dom_elmt,
 										  const QString &tag_name);
 
+	QByteArray readCurrentElement(
+			QXmlStreamReader &reader,
+			const std::function<void(const QXmlStreamReader &)> &start_element_visitor = nullptr);
+
 	QDomElement qGraphicsItemPosToXml(QGraphicsItem *item, QDomDocument &document);
 	bool qGraphicsItemPosFromXml(QGraphicsItem *item, const QDomElement &xml_elmt);
 
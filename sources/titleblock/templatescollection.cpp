@@ -384,6 +384,7 @@ TitleBlockTemplatesFilesCollection::TitleBlockTemplatesFilesCollection(const QSt
 		watcher_.addPath(dir_.canonicalPath());
 	}
 	connect(&watcher_, SIGNAL(directoryChanged(const QString &)), this, SLOT(fileSystemChanged(const QString &)));
+	connect(&watcher_, SIGNAL(fileChanged(const QString &)), this, SLOT(templateFileChanged(const QString &)));
 }
 
 /**
@@ -419,21 +420,47 @@ QStringList TitleBlockTemplatesFilesCollection::templates()
 }
 
 /**
+	The file of a template is parsed once and kept in cache
+	while its modification time and size do not change,
+	the returned template is a copy of the cached one,
+	which share its logos.
 	@return the template which name is \a template_name, or 0 if the template
-	could not be loaded.
+	could not be loaded. The caller takes ownership of the returned template.
 */
 TitleBlockTemplate *TitleBlockTemplatesFilesCollection::getTemplate(const QString &template_name) {
-	if (!templates().contains(template_name)) return(nullptr);
+	if (template_name.isEmpty()) return(nullptr);
 
-	TitleBlockTemplate *tbtemplate = new TitleBlockTemplate();
 	QString tbt_file_path = path(template_name);
-
-	bool loading = tbtemplate -> loadFromXmlFile(tbt_file_path);
-	if (!loading) {
-		delete tbtemplate;
+	QFileInfo tbt_file_info(tbt_file_path);
+	if (!tbt_file_info.isFile() || !tbt_file_info.isReadable()) {
+		templates_cache_.remove(tbt_file_path);
 		return(nullptr);
 	}
-	return(tbtemplate);
+
+	auto cached = templates_cache_.constFind(tbt_file_path);
+	if (cached == templates_cache_.constEnd()
+		|| cached -> last_modified != tbt_file_info.lastModified()
+		|| cached -> size != tbt_file_info.size())
+	{
+		TitleBlockTemplate *tbtemplate = new TitleBlockTemplate();
+		bool loading = tbtemplate -> loadFromXmlFile(tbt_file_path);
+		if (!loading) {
+			delete tbtemplate;
+			templates_cache_.remove(tbt_file_path);
+			return(nullptr);
+		}
+
+		CachedTemplate cached_template;
+		cached_template.last_modified = tbt_file_info.lastModified();
+		cached_template.size = tbt_file_info.size();
+		cached_template.tbt = QSharedPointer<const TitleBlockTemplate>(tbtemplate);
+		cached = templates_cache_.insert(tbt_file_path, cached_template);
+
+		if (!watcher_.files().contains(tbt_file_path)) {
+			watcher_.addPath(tbt_file_path);
+		}
+	}
+	return(cached -> tbt -> clone());
 }
 
 /**
@@ -472,6 +499,7 @@ bool TitleBlockTemplatesFilesCollection::setTemplateXmlDescription(const QString
 
 	// prevent the watcher from emitting signals while we open and write to file
 	blockSignals(true);
+	templates_cache_.remove(path(template_name));
 
 	QDomDocument doc;
 	doc.appendChild(doc.importNode(xml_element, true));
@@ -494,6 +522,7 @@ void TitleBlockTemplatesFilesCollection::removeTemplate(const QString &template_
 	blockSignals(true);
 
 	dir_.remove(toFileName(template_name));
+	templates_cache_.remove(path(template_name));
 
 	// emit a single signal for the removal
 	blockSignals(false);
@@ -569,3 +598,13 @@ void TitleBlockTemplatesFilesCollection::fileSystemChanged(const QString &str) {
 	dir_.refresh();
 	emit(changed(this));
 }
+
+/**
+	Handle the changes of the template files already parsed :
+	the cached template of \a file_path is dropped,
+	it will be parsed again at the next request.
+	@param file_path Path of the template file that changed.
+*/
+void TitleBlockTemplatesFilesCollection::templateFileChanged(const QString &file_path) {
+	templates_cache_.remove(file_path);
+}
@@ -150,9 +150,18 @@ class TitleBlockTemplatesFilesCollection : public TitleBlockTemplatesCollection
 	
 	private slots:
 	void fileSystemChanged(const QString &str);
+	void templateFileChanged(const QString &file_path);
 	
 	// attributes
 	private:
+	/// A parsed template, with the state of its file when it was parsed
+	struct CachedTemplate {
+		QDateTime last_modified;
+		qint64 size = 0;
+		QSharedPointer<const TitleBlockTemplate> tbt;
+	};
+	/// Templates already parsed, by file path
+	QHash<QString, CachedTemplate> templates_cache_;
 	/// File System Watcher object to track the files changes made outside the application
 	QFileSystemWatcher watcher_;
 	/// Collection real directory
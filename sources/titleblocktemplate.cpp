@@ -21,6 +21,7 @@
 #include "createdxf.h"
 #include "qet.h"
 #include "qetapp.h"
+#include "utils/formulatemplate.h"
 // uncomment the line below to get more debug information
 //#define TITLEBLOCK_TEMPLATE_DEBUG
 
@@ -213,13 +214,9 @@ TitleBlockTemplate *TitleBlockTemplate::clone() const
 #endif
 	}
 
-	// we have to create new QSvgRenderer objects from the data
-	// (no copy constructor)
-	foreach (QString logo_key, vector_logos_.keys()) {
-		copy -> vector_logos_[logo_key] =
-				new QSvgRenderer(data_logos_[logo_key]);
-	}
-
+	// the renderers are never modified once loaded,
+	// the copy share them instead of parsing the svg data again
+	copy -> vector_logos_  = vector_logos_;
 	copy -> data_logos_    = data_logos_;
 	copy -> storage_logos_ = storage_logos_;
 	copy -> type_logos_    = type_logos_;
@@ -279,7 +276,6 @@ void TitleBlockTemplate::loadInformation(const QDomElement &xml_element) {
 */
 bool TitleBlockTemplate::loadLogos(const QDomElement &xml_element, bool reset) {
 	if (reset) {
-		qDeleteAll(vector_logos_.begin(), vector_logos_.end());
 		vector_logos_.clear();
 
 		// Note:
@@ -1287,7 +1283,7 @@ bool TitleBlockTemplate::addLogo(const QString &logo_name,
 	// we can now create our image object from the byte array
 	if (logo_type == "svg") {
 		// SVG format is handled by the QSvgRenderer class
-		QSvgRenderer *svg = new QSvgRenderer();
+		QSharedPointer<QSvgRenderer> svg(new QSvgRenderer());
 		if (!svg -> load(*logo_data)) {
 			return(false);
 		}
@@ -1388,7 +1384,7 @@ bool TitleBlockTemplate::removeLogo(const QString &logo_name) {
 #endif
 	/// TODO check existing cells using this logo.
 	if (vector_logos_.contains(logo_name)) {
-		delete vector_logos_.take(logo_name);
+		vector_logos_.remove(logo_name);
 	}
 	if (bitmap_logos_.contains(logo_name)) {
 		bitmap_logos_.remove(logo_name);
@@ -1475,7 +1471,7 @@ QString TitleBlockTemplate::logoType(const QString &logo_name) const
 QSvgRenderer *TitleBlockTemplate::vectorLogo(const QString &logo_name) const
 {
 	if (vector_logos_.contains(logo_name)) {
-		return vector_logos_[logo_name];
+		return vector_logos_[logo_name].data();
 	}
 	return(nullptr);
 }
@@ -1564,31 +1560,30 @@ void TitleBlockTemplate::render(QPainter &painter,
 	Diagram context to use to generate the titleblock strings
 	@param titleblock_width :
 	Width of the titleblock to render
-	@param file_path :
+	@param dxf : the dxf writer
 	@param color :
 */
 void TitleBlockTemplate::renderDxf(QRectF &title_block_rect,
 				   const DiagramContext &diagram_context,
 				   int titleblock_width,
-				   QString &file_path,
+				   Createdxf &dxf,
 				   int color) const
 {
 	QList<int> widths = columnsWidth(titleblock_width);
 
 	// draw the titleblock border
-	double xCoord    = title_block_rect.topLeft().x()*Createdxf::xScale;
+	double xCoord    = title_block_rect.topLeft().x()*dxf.xScale();
 	double yCoord    =
 		Createdxf::sheetHeight
 			- title_block_rect.bottomLeft().y()
-			*Createdxf::yScale;
-	double recWidth  = title_block_rect.width()  * Createdxf::xScale;
-	double recHeight = title_block_rect.height() * Createdxf::yScale;
-	Createdxf::drawRectangle(file_path,
-				 xCoord,
-				 yCoord,
-				 recWidth,
-				 recHeight,
-				 color);
+			*dxf.yScale();
+	double recWidth  = title_block_rect.width()  * dxf.xScale();
+	double recHeight = title_block_rect.height() * dxf.yScale();
+	dxf.drawRectangle(xCoord,
+			  yCoord,
+			  recWidth,
+			  recHeight,
+			  color);
 
 	// run through each individual cell
 	for (int j = 0 ; j < rows_heights_.count() ; ++ j) {
@@ -1617,18 +1612,18 @@ void TitleBlockTemplate::renderDxf(QRectF &title_block_rect,
 						   cells_[i][j] -> num_row + 1 + row_span,
 						   rows_heights_);
 
-			x = xCoord + x*Createdxf::xScale;
-			h *= Createdxf::yScale;
-			y = yCoord + recHeight - h - y*Createdxf::yScale;
-			w *= Createdxf::xScale;
+			x = xCoord + x*dxf.xScale();
+			h *= dxf.yScale();
+			y = yCoord + recHeight - h - y*dxf.yScale();
+			w *= dxf.xScale();
 
-			Createdxf::drawRectangle(file_path, x, y, w, h, color);
+			dxf.drawRectangle(x, y, w, h, color);
 			if (cells_[i][j] -> type() == TitleBlockCell::TextCell)
 			{
 				QString final_text =
 						finalTextForCell(*cells_[i][j],
 								 diagram_context);
-				renderTextCellDxf(file_path,
+				renderTextCellDxf(dxf,
 						  final_text,
 						  *cells_[i][j],
 						  x,
@@ -1736,6 +1731,30 @@ QString TitleBlockTemplate::finalTextForCell(
 QString TitleBlockTemplate::interpreteVariables(
 		const QString &string,
 		const DiagramContext &diagram_context) const
+{
+	const QString interpreted_string =
+			FormulaTemplate::compile(string, FormulaTemplate::BracedAndBare)
+			.evaluate(diagram_context);
+		//A value brought a new variable, see FormulaTemplate
+	if (!interpreted_string.contains(QLatin1Char('%'))) {
+		return interpreted_string;
+	}
+
+	return interpreteVariablesSequentially(string, diagram_context);
+}
+
+/**
+	@brief TitleBlockTemplate::interpreteVariablesSequentially
+	Slow path of interpreteVariables : replace the variables
+	one after the other, from the longest key to the shortest.
+	@param string
+	@param diagram_context
+	@return the provided string with variables replaced by the values
+	from the diagram context
+*/
+QString TitleBlockTemplate::interpreteVariablesSequentially(
+		const QString &string,
+		const DiagramContext &diagram_context) const
 {
 	QString interpreted_string = string;
 	foreach (QString key,
@@ -1835,7 +1854,7 @@ void TitleBlockTemplate::renderTextCell(QPainter &painter,
 
 /**
 	@brief TitleBlockTemplate::renderTextCellDxf
-	@param file_path
+	@param dxf : the dxf writer
 	@param text
 	@param cell
 	@param x
@@ -1845,7 +1864,7 @@ void TitleBlockTemplate::renderTextCell(QPainter &painter,
 	@param color
 */
 void TitleBlockTemplate::renderTextCellDxf(
-		QString &file_path,
+		Createdxf &dxf,
 		const QString &text,
 		const TitleBlockCell &cell,
 		qreal x,
@@ -1871,7 +1890,7 @@ void TitleBlockTemplate::renderTextCellDxf(
 	if ( cell.alignment & Qt::AlignTop )
 	{
 		vAlign = 3;
-		y1 = y + h - (textHeight*Createdxf::yScale / 8);
+		y1 = y + h - (textHeight*dxf.yScale() / 8);
 	}
 	else if ( cell.alignment & Qt::AlignVCenter )
 	{
@@ -1880,7 +1899,7 @@ void TitleBlockTemplate::renderTextCellDxf(
 	}
 	else if ( cell.alignment & Qt::AlignBottom )
 	{
-		y1 = y + (textHeight*Createdxf::yScale / 8);
+		y1 = y + (textHeight*dxf.yScale() / 8);
 	}
 
 	if ( cell.alignment & Qt::AlignRight )
@@ -1898,7 +1917,7 @@ void TitleBlockTemplate::renderTextCellDxf(
 		hAlign = 5;
 		vAlign = 0;
 		x2 = x + w;
-		y1 = y + textHeight*Createdxf::yScale / 8;
+		y1 = y + textHeight*dxf.yScale() / 8;
 	}
 
 	//painter.setFont(text_font);
@@ -1908,19 +1927,18 @@ void TitleBlockTemplate::renderTextCellDxf(
 	{
 	// Scale font width to fit string in cell width w
 	// As DXF font aspect ratio is implementation dependent we add a fudge-factor based on tests with AutoCAD
-		int len = text.length() * textHeight * Createdxf::xScale * 1.2;
+		int len = text.length() * textHeight * dxf.xScale() * 1.2;
 
 		if(len > w)
 			ratio = (w/len);
 	}
 
 	// x offset value below currently set heuristically based on appearance...
-	Createdxf::drawTextAligned(
-				file_path,
+	dxf.drawTextAligned(
 				text,
-				x - 2*Createdxf::xScale,
+				x - 2*dxf.xScale(),
 				y1,
-				textHeight*Createdxf::yScale,
+				textHeight*dxf.yScale(),
 				0,
 				0,
 				hAlign,
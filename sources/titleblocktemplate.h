@@ -25,6 +25,8 @@
 #include <QtSvg>
 #include <QtXml>
 
+class Createdxf;
+
 /**
 	@brief The TitleBlockTemplate class
 	This class represents an title block template for an electric diagram.
@@ -110,7 +112,7 @@ class TitleBlockTemplate : public QObject {
 			QRectF &,
 			const DiagramContext &,
 			int,
-			QString &,
+			Createdxf &,
 			int) const;
 	void renderCell(QPainter &,
 			const TitleBlockCell &,
@@ -153,13 +155,16 @@ class TitleBlockTemplate : public QObject {
 	QString interpreteVariables(
 			const QString &,
 			const DiagramContext &) const;
+	QString interpreteVariablesSequentially(
+			const QString &,
+			const DiagramContext &) const;
 	void renderTextCell(
 			QPainter &,
 			const QString &,
 			const TitleBlockCell &,
 			const QRectF &) const;
 	void renderTextCellDxf(
-			QString &,
+			Createdxf &,
 			const QString &,
 			const TitleBlockCell &,
 			qreal,
@@ -193,7 +198,7 @@ class TitleBlockTemplate : public QObject {
 	/**
 		@brief vector_logos_ : Rendered objects for vector logos
 	*/
-	QHash<QString, QSvgRenderer *> vector_logos_;
+	QHash<QString, QSharedPointer<QSvgRenderer>> vector_logos_;
 	/**
 		@brief bitmap_logos_ : Pixmaps for bitmap logos
 	*/
@@ -105,18 +105,18 @@ void TitleBlockTemplateRenderer::render(QPainter *provided_painter,
 	@brief TitleBlockTemplateRenderer::renderDxf
 	@param title_block_rect
 	@param titleblock_width
-	@param file_path
+	@param dxf : the dxf writer
 	@param color
 */
 void TitleBlockTemplateRenderer::renderDxf(QRectF &title_block_rect,
 					   int titleblock_width,
-					   QString &file_path,
+					   Createdxf &dxf,
 					   int color) {
 	if (!m_titleblock_template) return;
 	m_titleblock_template -> renderDxf(title_block_rect,
 					   m_context,
 					   titleblock_width,
-					   file_path, color);
+					   dxf, color);
 }
 
 /**
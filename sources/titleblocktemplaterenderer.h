@@ -20,6 +20,7 @@
 #include <QPicture>
 #include "diagramcontext.h"
 
+class Createdxf;
 class TitleBlockTemplate;
 /**
 	@brief The TitleBlockTemplateRenderer class
@@ -40,7 +41,7 @@ class TitleBlockTemplateRenderer : public QObject
 		
 		int height() const;
 		void render(QPainter *, int);
-		void renderDxf(QRectF &, int, QString &, int);
+		void renderDxf(QRectF &, int, Createdxf &, int);
 		void invalidateRenderedTemplate();
 		void setUseCache(bool);
 		bool useCache() const;
@@ -65,8 +65,8 @@ GeneralConfigurationPage::GeneralConfigurationPage(QWidget *parent) :
 			break;
 	}
 #endif
-	ui->DiagramEditor_xGrid_sb->setValue(settings.value("diagrameditor/Xgrid", 10).toInt());
-	ui->DiagramEditor_yGrid_sb->setValue(settings.value("diagrameditor/Ygrid", 10).toInt());
+	ui->DiagramEditor_xGrid_sb->setValue(QetSettings::gridXStep());
+	ui->DiagramEditor_yGrid_sb->setValue(QetSettings::gridYStep());
 	ui->DiagramEditor_xKeyGrid_sb->setValue(settings.value("diagrameditor/key_Xgrid", 10).toInt());
 	ui->DiagramEditor_yKeyGrid_sb->setValue(settings.value("diagrameditor/key_Ygrid", 10).toInt());
 	ui->DiagramEditor_xKeyGridFine_sb->setValue(settings.value("diagrameditor/key_fine_Xgrid", 1).toInt());
@@ -77,13 +77,14 @@ GeneralConfigurationPage::GeneralConfigurationPage(QWidget *parent) :
 		ui->m_use_tab_mode_rb->setChecked(true);
 	else
 		ui->m_use_windows_mode_rb->setChecked(true);
-	ui->m_zoom_out_beyond_folio->setChecked(settings.value("diagrameditor/zoom-out-beyond-of-folio", false).toBool());
+	ui->m_zoom_out_beyond_folio->setChecked(QetSettings::zoomOutBeyondOfFolio());
 	ui->m_use_gesture_trackpad->setChecked(settings.value("diagramview/gestures", false).toBool());
 	ui->m_save_label_paste->setChecked(settings.value("diagramcommands/erase-label-on-copy", true).toBool());
 	ui->m_use_folio_label->setChecked(settings.value("genericpanel/folio", true).toBool());
 	ui->m_export_terminal->setChecked(settings.value("nomenclature-exportlist", true).toBool());
 	ui->m_border_0->setChecked(settings.value("border-columns_0", false).toBool());
 	ui->m_autosave_sb->setValue(settings.value("diagrameditor/autosave-interval", 0).toInt());
+	ui->m_max_folio_views_sb->setValue(settings.value("diagrameditor/max-folio-views", 0).toInt());
 	
 	QString fontInfos = settings.value("diagramitemfont").toString() + " " +
 			settings.value("diagramitemsize").toString() + " (" +
@@ -228,11 +229,12 @@ void GeneralConfigurationPage::applyConf()
 	QString view_mode = ui->m_use_tab_mode_rb->isChecked() ? "tabbed" : "windowed";
 	settings.setValue("diagrameditor/viewmode", view_mode) ;
 	settings.setValue("diagrameditor/highlight-integrated-elements", ui->m_highlight_integrated_elements->isChecked());
-	settings.setValue("diagrameditor/zoom-out-beyond-of-folio", ui->m_zoom_out_beyond_folio->isChecked());
+	QetSettings::setZoomOutBeyondOfFolio(ui->m_zoom_out_beyond_folio->isChecked());
 	settings.setValue("diagrameditor/autosave-interval", ui->m_autosave_sb->value());
+	settings.setValue("diagrameditor/max-folio-views", ui->m_max_folio_views_sb->value());
 		//Grid step and key navigation
-	settings.setValue("diagrameditor/Xgrid", ui->DiagramEditor_xGrid_sb->value());
-	settings.setValue("diagrameditor/Ygrid", ui->DiagramEditor_yGrid_sb->value());
+	QetSettings::setGridStep(ui->DiagramEditor_xGrid_sb->value(),
+				 ui->DiagramEditor_yGrid_sb->value());
 	settings.setValue("diagrameditor/key_Xgrid", ui->DiagramEditor_xKeyGrid_sb->value());
 	settings.setValue("diagrameditor/key_Ygrid", ui->DiagramEditor_yKeyGrid_sb->value());
 	settings.setValue("diagrameditor/key_fine_Xgrid", ui->DiagramEditor_xKeyGridFine_sb->value());
@@ -113,6 +113,7 @@ DiagramPropertiesDialog::DiagramPropertiesDialog(Diagram *diagram, QWidget *pare
 #endif
 			/// TODO implement an undo command to allow the user to undo/redo this action
 			diagram -> defaultConductorProperties = new_conductors;
+			diagram -> invalidateBackup();
 		}
 
 			// Conductor autonum name
@@ -30,7 +30,12 @@ DiagramPropertiesEditorDockWidget::DiagramPropertiesEditorDockWidget(QWidget *pa
 	PropertiesEditorDockWidget(parent),
 	m_diagram(nullptr),
 	m_edited_qgi_type (-1)
-{}
+{
+	m_selection_timer.setSingleShot(true);
+	m_selection_timer.setInterval(0);
+	connect(&m_selection_timer, &QTimer::timeout,
+		this, &DiagramPropertiesEditorDockWidget::selectionChanged);
+}
 
 /**
 	@brief DiagramPropertiesEditorDockWidget::setDiagram
@@ -46,7 +51,7 @@ void DiagramPropertiesEditorDockWidget::setDiagram(Diagram *diagram)
 	if (m_diagram)
 	{
 		disconnect(m_diagram, SIGNAL(selectionChanged()),
-			   this, SLOT(selectionChanged()));
+			   &m_selection_timer, SLOT(start()));
 		disconnect(m_diagram, SIGNAL(destroyed()),
 			   this, SLOT(diagramWasDeleted()));
 	}
@@ -54,14 +59,17 @@ void DiagramPropertiesEditorDockWidget::setDiagram(Diagram *diagram)
 	if (diagram)
 	{
 		m_diagram = diagram;
+			//Rebuild the editor one time per event loop turn,
+			//not one time per selection change
 		connect(m_diagram, SIGNAL(selectionChanged()),
-			this, SLOT(selectionChanged()), Qt::QueuedConnection);
+			&m_selection_timer, SLOT(start()));
 		connect(m_diagram, SIGNAL(destroyed()),
 			this, SLOT(diagramWasDeleted()));
 		selectionChanged();
 	}
 	else
 	{
+		m_selection_timer.stop();
 		m_diagram = nullptr;
 		m_edited_qgi_type = -1;
 		clear();
@@ -104,6 +112,7 @@ void DiagramPropertiesEditorDockWidget::selectionChanged()
 */
 void DiagramPropertiesEditorDockWidget::diagramWasDeleted()
 {
+	m_selection_timer.stop();
 	m_diagram = nullptr;
 	m_edited_qgi_type = -1;
 	clear();
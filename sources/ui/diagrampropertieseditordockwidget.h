@@ -20,6 +20,8 @@
 
 #include "../PropertiesEditor/propertieseditordockwidget.h"
 
+#include <QTimer>
+
 class Diagram;
 
 class DiagramPropertiesEditorDockWidget : public PropertiesEditorDockWidget
@@ -44,6 +46,8 @@ class DiagramPropertiesEditorDockWidget : public PropertiesEditorDockWidget
 	private:
 		Diagram *m_diagram;
 		int m_edited_qgi_type;
+			///Coalesce the selection changes of m_diagram
+		QTimer m_selection_timer;
 };
 
 #endif // DIAGRAMPROPERTIESEDITORDOCKWIDGET_H
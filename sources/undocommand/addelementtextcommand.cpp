@@ -75,6 +75,18 @@ void AddElementTextCommand::redo()
 	m_element->addDynamicTextItem(m_text);
 }
 
+/**
+	@brief AddElementTextCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool AddElementTextCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	if (m_element) {
+		diagrams.insert(m_element->diagram());
+	}
+	return true;
+}
+
 
 /***********************
  * AddTextsGroupCommand*
@@ -199,6 +211,18 @@ void AddTextsGroupCommand::redo()
 	}
 }
 
+/**
+	@brief AddTextsGroupCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool AddTextsGroupCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	if (m_element) {
+		diagrams.insert(m_element->diagram());
+	}
+	return true;
+}
+
 
 /**************************
  * RemoveTextsGroupCommand*
@@ -262,6 +286,18 @@ void RemoveTextsGroupCommand::redo()
 	}
 }
 
+/**
+	@brief RemoveTextsGroupCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool RemoveTextsGroupCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	if (m_element) {
+		diagrams.insert(m_element->diagram());
+	}
+	return true;
+}
+
 
 /************************
  * AddTextToGroupCommand*
@@ -322,6 +358,18 @@ void AddTextToGroupCommand::redo()
 	}
 }
 
+/**
+	@brief AddTextToGroupCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool AddTextToGroupCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	if (m_element) {
+		diagrams.insert(m_element->diagram());
+	}
+	return true;
+}
+
 /*****************************
  * RemoveTextFromGroupCommand*
  * ***************************/
@@ -375,6 +423,18 @@ void RemoveTextFromGroupCommand::redo()
 		m_element.data()->removeTextFromGroup(m_text, m_group);
 }
 
+/**
+	@brief RemoveTextFromGroupCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool RemoveTextFromGroupCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	if (m_element) {
+		diagrams.insert(m_element->diagram());
+	}
+	return true;
+}
+
 
 /*****************************
  * AlignmentTextsGroupCommand*
@@ -462,3 +522,15 @@ void AlignmentTextsGroupCommand::redo()
 	if(m_group)
 		m_group.data()->setAlignment(m_new_alignment);
 }
+
+/**
+	@brief AlignmentTextsGroupCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool AlignmentTextsGroupCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	if (m_group) {
+		diagrams.insert(m_group->diagram());
+	}
+	return true;
+}
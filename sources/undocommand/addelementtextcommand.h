@@ -23,6 +23,8 @@
 #include <QDomElement>
 #include <QHash>
 
+#include "diagramsundocommand.h"
+
 class Element;
 class DynamicElementTextItem;
 class ElementTextItemGroup;
@@ -31,7 +33,7 @@ class ElementTextItemGroup;
 	@brief The AddElementTextCommand class
 	Manage the adding of element text
 */
-class AddElementTextCommand : public QUndoCommand
+class AddElementTextCommand : public QUndoCommand, public DiagramsUndoCommand
 {
 	public:
 		AddElementTextCommand(Element *element,
@@ -41,6 +43,7 @@ class AddElementTextCommand : public QUndoCommand
 
 		void undo() override;
 		void redo() override;
+		bool changedDiagrams(QSet<Diagram *> &diagrams) const override;
 
 	private:
 		Element *m_element = nullptr;
@@ -51,7 +54,7 @@ class AddElementTextCommand : public QUndoCommand
 	@brief The AddTextsGroupCommand class
 	Manage the adding of a texts group
 */
-class AddTextsGroupCommand : public QUndoCommand
+class AddTextsGroupCommand : public QUndoCommand, public DiagramsUndoCommand
 {
 	public:
 		AddTextsGroupCommand(Element *element,
@@ -68,6 +71,7 @@ class AddTextsGroupCommand : public QUndoCommand
 
 		void undo() override;
 		void redo() override;
+		bool changedDiagrams(QSet<Diagram *> &diagrams) const override;
 
 	private:
 		QPointer<Element> m_element;
@@ -82,7 +86,7 @@ class AddTextsGroupCommand : public QUndoCommand
 	@brief The RemoveTextsGroupCommand class
 	Manage the removinf of a texts group
 */
-class RemoveTextsGroupCommand : public QUndoCommand
+class RemoveTextsGroupCommand : public QUndoCommand, public DiagramsUndoCommand
 {
 	public:
 		RemoveTextsGroupCommand(Element *element,
@@ -92,6 +96,7 @@ class RemoveTextsGroupCommand : public QUndoCommand
 
 		void undo() override;
 		void redo() override;
+		bool changedDiagrams(QSet<Diagram *> &diagrams) const override;
 
 	private:
 		QPointer<Element> m_element;
@@ -102,7 +107,7 @@ class RemoveTextsGroupCommand : public QUndoCommand
 /**
 	@brief The AddTextToGroupCommand class
 */
-class AddTextToGroupCommand : public QUndoCommand
+class AddTextToGroupCommand : public QUndoCommand, public DiagramsUndoCommand
 {
 	public:
 		AddTextToGroupCommand(DynamicElementTextItem *text,
@@ -112,6 +117,7 @@ class AddTextToGroupCommand : public QUndoCommand
 
 		void undo() override;
 		void redo() override;
+		bool changedDiagrams(QSet<Diagram *> &diagrams) const override;
 
 	private:
 		QPointer<DynamicElementTextItem> m_text;
@@ -122,7 +128,7 @@ class AddTextToGroupCommand : public QUndoCommand
 /**
 	@brief The RemoveTextFromGroupCommand class
 */
-class RemoveTextFromGroupCommand : public QUndoCommand
+class RemoveTextFromGroupCommand : public QUndoCommand, public DiagramsUndoCommand
 {
 	public:
 		RemoveTextFromGroupCommand(DynamicElementTextItem *text,
@@ -132,6 +138,7 @@ class RemoveTextFromGroupCommand : public QUndoCommand
 
 		void undo() override;
 		void redo() override;
+		bool changedDiagrams(QSet<Diagram *> &diagrams) const override;
 
 	private:
 		QPointer<DynamicElementTextItem> m_text;
@@ -142,7 +149,7 @@ class RemoveTextFromGroupCommand : public QUndoCommand
 /**
 	@brief The AlignmentTextsGroupCommand class
 */
-class AlignmentTextsGroupCommand : public QUndoCommand
+class AlignmentTextsGroupCommand : public QUndoCommand, public DiagramsUndoCommand
 {
 	public:
 		AlignmentTextsGroupCommand(ElementTextItemGroup *group,
@@ -154,6 +161,7 @@ class AlignmentTextsGroupCommand : public QUndoCommand
 		bool mergeWith(const QUndoCommand *other) override;
 		void undo() override;
 		void redo() override;
+		bool changedDiagrams(QSet<Diagram *> &diagrams) const override;
 
 	private:
 		QPointer<ElementTextItemGroup> m_group;
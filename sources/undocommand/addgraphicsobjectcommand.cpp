@@ -76,6 +76,16 @@ void AddGraphicsObjectCommand::redo()
 	QUndoCommand::redo();
 }
 
+/**
+ * @brief AddGraphicsObjectCommand::changedDiagrams
+ * Reimplemented from DiagramsUndoCommand
+ */
+bool AddGraphicsObjectCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	diagrams.insert(m_diagram);
+	return true;
+}
+
 /**
  * @brief AddGraphicsObjectCommand::itemText
  * @return
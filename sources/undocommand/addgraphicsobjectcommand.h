@@ -22,6 +22,8 @@
 #include <QPointF>
 #include <QPointer>
 
+#include "diagramsundocommand.h"
+
 class QGraphicsObject;
 class Diagram;
 
@@ -29,7 +31,7 @@ class Diagram;
  * @brief The AddGraphicsObjectCommand class
  * Undo command to used to add item to a diagram.
  */
-class AddGraphicsObjectCommand : public QUndoCommand
+class AddGraphicsObjectCommand : public QUndoCommand, public DiagramsUndoCommand
 {
    public:
 		AddGraphicsObjectCommand(QGraphicsObject *qgo, Diagram *diagram,
@@ -39,6 +41,7 @@ class AddGraphicsObjectCommand : public QUndoCommand
 
 		void undo() override;
 		void redo() override;
+		bool changedDiagrams(QSet<Diagram *> &diagrams) const override;
 
 	private:
 		QString itemText() const;
@@ -38,3 +38,15 @@ void ChangeElementDataCommand::redo() {
 		m_element.data()->setElementData(m_new_data);
 	}
 }
+
+/**
+	@brief ChangeElementDataCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool ChangeElementDataCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	if (m_element) {
+		diagrams.insert(m_element->diagram());
+	}
+	return true;
+}
@@ -19,16 +19,18 @@
 #define CHANGEELEMENTDATACOMMAND_H
 
 #include <../properties/elementdata.h>
+#include "diagramsundocommand.h"
 #include <QUndoCommand>
 
 class Element;
 
-class ChangeElementDataCommand : public QUndoCommand
+class ChangeElementDataCommand : public QUndoCommand, public DiagramsUndoCommand
 {
 	public:
 		ChangeElementDataCommand(Element *element, ElementData new_data, QUndoCommand *parent = nullptr);
 		void undo() override;
 		void redo() override;
+		bool changedDiagrams(QSet<Diagram *> &diagrams) const override;
 
 	private:
 		QPointer<Element> m_element;
@@ -105,6 +105,20 @@ void ChangeElementInformationCommand::redo()
 	updateProjectDB();
 }
 
+/**
+	@brief ChangeElementInformationCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool ChangeElementInformationCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	for (const auto &element : m_map.keys()) {
+		if (element) {
+			diagrams.insert(element->diagram());
+		}
+	}
+	return true;
+}
+
 void ChangeElementInformationCommand::updateProjectDB()
 {
 	auto elmt = m_map.keys().first().data();
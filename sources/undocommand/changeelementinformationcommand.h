@@ -19,6 +19,7 @@
 #define CHANGEELEMENTINFORMATIONCOMMAND_H
 
 #include "../diagramcontext.h"
+#include "diagramsundocommand.h"
 
 #include <QUndoCommand>
 
@@ -28,7 +29,7 @@ class Element;
 	@brief The ChangeElementInformationCommand class
 	This class manage undo/redo to change the element information.
 */
-class ChangeElementInformationCommand : public QUndoCommand
+class ChangeElementInformationCommand : public QUndoCommand, public DiagramsUndoCommand
 {
 	public:
 		ChangeElementInformationCommand(
@@ -44,6 +45,7 @@ class ChangeElementInformationCommand : public QUndoCommand
 		bool mergeWith(const QUndoCommand *other) override;
 		void undo() override;
 		void redo() override;
+		bool changedDiagrams(QSet<Diagram *> &diagrams) const override;
 
 	private:
 		void updateProjectDB();
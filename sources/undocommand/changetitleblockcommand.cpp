@@ -55,3 +55,13 @@ void ChangeTitleBlockCommand::redo()
 	diagram -> border_and_titleblock.importTitleBlock(new_titleblock);
 	diagram -> invalidate(diagram -> border_and_titleblock.borderAndTitleBlockRect());
 }
+
+/**
+	@brief ChangeTitleBlockCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool ChangeTitleBlockCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	diagrams.insert(diagram);
+	return true;
+}
@@ -19,6 +19,7 @@
 #define CHANGETITLEBLOCKCOMMAND_H
 
 #include "../titleblockproperties.h"
+#include "diagramsundocommand.h"
 
 #include <QUndoCommand>
 
@@ -27,7 +28,7 @@ class Diagram;
 	@brief The ChangeTitleBlockCommand class
 	This command changes the title block properties for a particular diagram.
 */
-class ChangeTitleBlockCommand : public QUndoCommand
+class ChangeTitleBlockCommand : public QUndoCommand, public DiagramsUndoCommand
 {
 	public:
 		ChangeTitleBlockCommand(Diagram *, const TitleBlockProperties &, const TitleBlockProperties &, QUndoCommand * = nullptr);
@@ -38,6 +39,7 @@ class ChangeTitleBlockCommand : public QUndoCommand
 	public:
 		void undo() override;
 		void redo() override;
+		bool changedDiagrams(QSet<Diagram *> &diagrams) const override;
 	
 	private:
 		Diagram *diagram;
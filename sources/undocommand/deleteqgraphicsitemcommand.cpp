@@ -335,3 +335,19 @@ void DeleteQGraphicsItemCommand::redo()
 
 	QUndoCommand::redo();
 }
+
+/**
+	@brief DeleteQGraphicsItemCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool DeleteQGraphicsItemCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	diagrams.insert(m_diagram);
+		//The elements linked to the removed elements are unlinked
+	for (const auto &linked_elements : m_link_hash) {
+		for (auto element : linked_elements) {
+			diagrams.insert(element->diagram());
+		}
+	}
+	return true;
+}
@@ -19,6 +19,7 @@
 #define DELETEQGRAPHICSITEMCOMMAND_H
 
 #include "../diagramcontent.h"
+#include "diagramsundocommand.h"
 
 #include <QHash>
 #include <QUndoCommand>
@@ -29,7 +30,7 @@ class Terminal;
 class QetGraphicsTableItem;
 class QGraphicsScene;
 
-class DeleteQGraphicsItemCommand : public QUndoCommand
+class DeleteQGraphicsItemCommand : public QUndoCommand, public DiagramsUndoCommand
 {
 	public:
 		DeleteQGraphicsItemCommand(Diagram *diagram, const DiagramContent &content, QUndoCommand * parent = nullptr);
@@ -44,6 +45,7 @@ class DeleteQGraphicsItemCommand : public QUndoCommand
 	public:
 		void undo() override;
 		void redo() override;
+		bool changedDiagrams(QSet<Diagram *> &diagrams) const override;
 
 		// attributes
 	private:
@@ -0,0 +1,81 @@
+/*
+	Copyright 2006-2024 The QElectroTech Team
+	This file is part of QElectroTech.
+	
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+	
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "diagramsundocommand.h"
+
+#include "../diagram.h"
+
+#include <QUndoCommand>
+#include <typeinfo>
+
+/**
+ * @brief DiagramsUndoCommand::changedDiagrams
+ * Add to @diagrams the diagrams changed by @command and its children.
+ * A plain QUndoCommand, used as macro, change only the diagrams
+ * of its children.
+ * @param command
+ * @param diagrams
+ * @return false if @command or one of its children doesn't know
+ * the diagrams it changes.
+ */
+bool DiagramsUndoCommand::changedDiagrams(const QUndoCommand *command,
+					  QSet<Diagram *> &diagrams)
+{
+	if (!command) {
+		return true;
+	}
+
+	if (auto diagrams_command = dynamic_cast<const DiagramsUndoCommand *>(command))
+	{
+		if (!diagrams_command->changedDiagrams(diagrams)) {
+			return false;
+		}
+	}
+	else if (typeid(*command) != typeid(QUndoCommand)) {
+		return false;
+	}
+
+	for (int i=0 ; i<command->childCount() ; ++i)
+	{
+		if (!changedDiagrams(command->child(i), diagrams)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * @brief DiagramsUndoCommand::diagramOf
+ * @param object
+ * @return the diagram of @object : the diagram itself, the diagram
+ * of a graphics item or the diagram parent of @object.
+ * nullptr if @object doesn't belong to a diagram.
+ */
+Diagram *DiagramsUndoCommand::diagramOf(const QObject *object)
+{
+	for (auto obj = object ; obj ; obj = obj->parent())
+	{
+		if (auto diagram = qobject_cast<const Diagram *>(obj)) {
+			return const_cast<Diagram *>(diagram);
+		}
+		if (auto item = dynamic_cast<const QGraphicsItem *>(obj)) {
+			return qobject_cast<Diagram *>(item->scene());
+		}
+	}
+	return nullptr;
+}
@@ -0,0 +1,51 @@
+/*
+	Copyright 2006-2024 The QElectroTech Team
+	This file is part of QElectroTech.
+	
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+	
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+	
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef DIAGRAMSUNDOCOMMAND_H
+#define DIAGRAMSUNDOCOMMAND_H
+
+#include <QSet>
+
+class Diagram;
+class QObject;
+class QUndoCommand;
+
+/**
+ * @brief The DiagramsUndoCommand class
+ * Interface of the undo commands which know the diagrams they change.
+ * Used by QETProject to serialize again, on the next backup,
+ * only the diagrams changed by the undo stack.
+ */
+class DiagramsUndoCommand
+{
+	public:
+		virtual ~DiagramsUndoCommand() = default;
+
+		/**
+		 * @brief changedDiagrams
+		 * Add to @diagrams the diagrams changed by the undo or the redo
+		 * of this command, children commands excepted.
+		 * @return false if the changed diagrams can't be known
+		 */
+		virtual bool changedDiagrams(QSet<Diagram *> &diagrams) const = 0;
+
+		static bool changedDiagrams(const QUndoCommand *command,
+					    QSet<Diagram *> &diagrams);
+		static Diagram *diagramOf(const QObject *object);
+};
+
+#endif // DIAGRAMSUNDOCOMMAND_H
@@ -223,6 +223,20 @@ void LinkElementCommand::redo()
 	QUndoCommand::redo();
 }
 
+/**
+	@brief LinkElementCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool LinkElementCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	diagrams.insert(m_element->diagram());
+		//The links are saved by the two linked elements
+	for (auto element : m_linked_before + m_linked_after) {
+		diagrams.insert(element->diagram());
+	}
+	return true;
+}
+
 /**
 	@brief LinkElementCommand::setUpNewLink
 	Update the content of m_link_after with the content of element_list.
@@ -18,6 +18,8 @@
 #ifndef LINKELEMENTCOMMAND_H
 #define LINKELEMENTCOMMAND_H
 
+#include "diagramsundocommand.h"
+
 #include <QUndoCommand>
 
 class Element;
@@ -28,7 +30,7 @@ class Element;
 	In the same instance of this class, we can link and unlink elements from an edited element
 	This undo class support the merge.
 */
-class LinkElementCommand : public QUndoCommand
+class LinkElementCommand : public QUndoCommand, public DiagramsUndoCommand
 {
 	public:
 		LinkElementCommand(Element *element_, QUndoCommand *parent = nullptr);
@@ -45,6 +47,7 @@ class LinkElementCommand : public QUndoCommand
 
 		void undo() override;
 		void redo() override;
+		bool changedDiagrams(QSet<Diagram *> &diagrams) const override;
 
 	private:
 		void setUpNewLink (const QList<Element *> &element_list, bool already_link);
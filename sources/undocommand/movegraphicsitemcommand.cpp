@@ -92,6 +92,16 @@ void MoveGraphicsItemCommand::redo()
 	QUndoCommand::redo();
 }
 
+/**
+ * @brief MoveGraphicsItemCommand::changedDiagrams
+ * Reimplemented from DiagramsUndoCommand
+ */
+bool MoveGraphicsItemCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	diagrams.insert(m_diagram.data());
+	return true;
+}
+
 /**
  * @brief MoveGraphicsItemCommand::move
  * Apply @a movement to items of m_content
@@ -23,6 +23,7 @@
 #include <QPointer>
 
 #include "../diagramcontent.h"
+#include "diagramsundocommand.h"
 
 class Diagram;
 
@@ -30,7 +31,7 @@ class Diagram;
  * @brief The MoveGraphicsItemCommand class
  * An undo command used for move item(s) in a diagram
  */
-class MoveGraphicsItemCommand : public QUndoCommand
+class MoveGraphicsItemCommand : public QUndoCommand, public DiagramsUndoCommand
 {
 	public:
 		MoveGraphicsItemCommand(Diagram *diagram,
@@ -46,6 +47,7 @@ class MoveGraphicsItemCommand : public QUndoCommand
 	public:
 		void undo() override;
 		void redo() override;
+		bool changedDiagrams(QSet<Diagram *> &diagrams) const override;
 
 	private:
 		void move(const QPointF &movement);
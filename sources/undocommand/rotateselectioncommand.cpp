@@ -111,6 +111,16 @@ void RotateSelectionCommand::redo()
 		}
 }
 
+/**
+	@brief RotateSelectionCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool RotateSelectionCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	diagrams.insert(m_diagram);
+	return true;
+}
+
 /**
 	@brief RotateSelectionCommand::isValid
 	@return true if this command rotate a least one item.
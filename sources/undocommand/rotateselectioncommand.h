@@ -22,6 +22,8 @@
 #include <QPointer>
 #include <QHash>
 
+#include "diagramsundocommand.h"
+
 class Diagram;
 class ConductorTextItem;
 class QPropertyUndoCommand;
@@ -30,12 +32,13 @@ class QPropertyUndoCommand;
 	@brief The RotateSelectionCommand class
 	Rotate the selected items in the given diagram
 */
-class RotateSelectionCommand : public QUndoCommand
+class RotateSelectionCommand : public QUndoCommand, public DiagramsUndoCommand
 {
 	public:
 		RotateSelectionCommand(Diagram *diagram, qreal angle=90, QUndoCommand *parent=nullptr);
 		void undo() override;
 		void redo() override;
+		bool changedDiagrams(QSet<Diagram *> &diagrams) const override;
 
 		bool isValid();
 
@@ -104,6 +104,16 @@ void RotateTextsCommand::redo()
 		cti->forceMovedByUser(true);
 }
 
+/**
+	@brief RotateTextsCommand::changedDiagrams
+	Reimplemented from DiagramsUndoCommand
+*/
+bool RotateTextsCommand::changedDiagrams(QSet<Diagram *> &diagrams) const
+{
+	diagrams.insert(m_diagram.data());
+	return true;
+}
+
 void RotateTextsCommand::openDialog()
 {
 		//Open the dialog
@@ -22,6 +22,8 @@
 #include <QPointer>
 #include <QHash>
 
+#include "diagramsundocommand.h"
+
 class ConductorTextItem;
 class Diagram;
 class QParallelAnimationGroup;
@@ -31,13 +33,14 @@ class QParallelAnimationGroup;
 	Open a dialog for edit the rotation of the current selected texts and texts group in diagram.
 	Just instantiate this undo command and push it in a QUndoStack.
 */
-class RotateTextsCommand : public QUndoCommand
+class RotateTextsCommand : public QUndoCommand, public DiagramsUndoCommand
 {
 	public:
 		RotateTextsCommand(Diagram *diagram, QUndoCommand *parent=nullptr);
 
 		void undo() override;
 		void redo() override;
+		bool changedDiagrams(QSet<Diagram *> &diagrams) const override;
 
 	private:
 		void openDialog();
@@ -0,0 +1,243 @@
+/*
+	Copyright 2006-2024 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "formulatemplate.h"
+
+#include "../diagramcontext.h"
+
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+
+namespace {
+	/**
+		@brief isKeyChar
+		@param c
+		@return true if c can be used in a key of a DiagramContext
+		@see DiagramContext::isKeyAcceptable
+	*/
+	inline bool isKeyChar(QChar c)
+	{
+		const ushort u = c.unicode();
+		return (u >= 'a' && u <= 'z')
+				|| (u >= '0' && u <= '9')
+				|| u == '-'
+				|| u == '_';
+	}
+
+	/**
+		@brief keyRunLength
+		@param formula
+		@param from
+		@return the number of key characters in formula from index from
+	*/
+	inline int keyRunLength(const QString &formula, int from)
+	{
+		int i = from;
+		while (i < formula.size() && isKeyChar(formula.at(i))) {
+			++i;
+		}
+		return i - from;
+	}
+
+		///The cache is cleared when it reach this size
+	const int max_cached_formulas = 4096;
+}
+
+/**
+	@brief FormulaTemplate::compile
+	@param formula
+	@param syntax
+	@return the compiled form of formula,
+	read from the cache or compiled and cached.
+*/
+FormulaTemplate FormulaTemplate::compile(const QString &formula, Syntax syntax)
+{
+	static QHash<QString, FormulaTemplate> braced_cache;
+	static QHash<QString, FormulaTemplate> bare_cache;
+	static QMutex mutex;
+
+	QHash<QString, FormulaTemplate> &cache = syntax == Braced ? braced_cache
+								  : bare_cache;
+	{
+		QMutexLocker locker(&mutex);
+		auto it = cache.constFind(formula);
+		if (it != cache.constEnd()) {
+			return it.value();
+		}
+	}
+
+	const FormulaTemplate compiled(formula, syntax);
+
+	QMutexLocker locker(&mutex);
+	if (cache.size() >= max_cached_formulas) {
+		cache.clear();
+	}
+	cache.insert(formula, compiled);
+	return compiled;
+}
+
+/**
+	@brief FormulaTemplate::evaluate
+	Replace every variable which is a key of context by its value,
+	a bare variable (%var) is replaced with the longest key
+	of context which start the text after the '%'.
+	@param context
+	@return the evaluated formula
+*/
+QString FormulaTemplate::evaluate(const DiagramContext &context) const
+{
+	QString result;
+	result.reserve(m_literal_size);
+
+	for (const Segment &segment : m_segments)
+	{
+		switch (segment.m_kind)
+		{
+			case Segment::Literal:
+				result += segment.m_text;
+				break;
+			case Segment::Variable:
+				if (context.contains(segment.m_text)) {
+					result += context.value(segment.m_text).toString();
+				} else {
+					result += QStringLiteral("%{") + segment.m_text + QLatin1Char('}');
+				}
+				break;
+			case Segment::BareVariable:
+			{
+				int length = segment.m_text.size();
+				while (length > 0 && !context.contains(segment.m_text.left(length))) {
+					--length;
+				}
+
+				if (length) {
+					result += context.value(segment.m_text.left(length)).toString();
+					result += segment.m_text.mid(length);
+				} else {
+					result += QLatin1Char('%') + segment.m_text;
+				}
+				break;
+			}
+		}
+	}
+
+	return result;
+}
+
+/**
+	@brief FormulaTemplate::evaluate
+	Replace every variable which is in keys by its value in context,
+	a key which is not in context is replaced by an empty string.
+	Bare variables are not replaced.
+	@param context
+	@param keys
+	@return the evaluated formula
+*/
+QString FormulaTemplate::evaluate(const DiagramContext &context,
+				  const QSet<QString> &keys) const
+{
+	QString result;
+	result.reserve(m_literal_size);
+
+	for (const Segment &segment : m_segments)
+	{
+		switch (segment.m_kind)
+		{
+			case Segment::Literal:
+				result += segment.m_text;
+				break;
+			case Segment::Variable:
+				if (keys.contains(segment.m_text)) {
+					result += context.value(segment.m_text).toString();
+				} else {
+					result += QStringLiteral("%{") + segment.m_text + QLatin1Char('}');
+				}
+				break;
+			case Segment::BareVariable:
+				result += QLatin1Char('%') + segment.m_text;
+				break;
+		}
+	}
+
+	return result;
+}
+
+/**
+	@brief FormulaTemplate::FormulaTemplate
+	Split formula in segments
+	@param formula
+	@param syntax
+*/
+FormulaTemplate::FormulaTemplate(const QString &formula, Syntax syntax)
+{
+	QString literal;
+	auto flushLiteral = [&]()
+	{
+		if (!literal.isEmpty())
+		{
+			m_literal_size += literal.size();
+			m_segments.append(Segment{Segment::Literal, literal});
+			literal.clear();
+		}
+	};
+
+	int i = 0;
+	while (i < formula.size())
+	{
+		const QChar c = formula.at(i);
+		if (c != QLatin1Char('%'))
+		{
+			literal += c;
+			++i;
+			continue;
+		}
+
+			//%{var}
+		if (i + 1 < formula.size() && formula.at(i + 1) == QLatin1Char('{'))
+		{
+			const int length = keyRunLength(formula, i + 2);
+			const int end = i + 2 + length;
+			if (length && end < formula.size() && formula.at(end) == QLatin1Char('}'))
+			{
+				flushLiteral();
+				m_segments.append(Segment{Segment::Variable,
+							  formula.mid(i + 2, length)});
+				i = end + 1;
+				continue;
+			}
+		}
+			//%var
+		else if (syntax == BracedAndBare)
+		{
+			const int length = keyRunLength(formula, i + 1);
+			if (length)
+			{
+				flushLiteral();
+				m_segments.append(Segment{Segment::BareVariable,
+							  formula.mid(i + 1, length)});
+				i += 1 + length;
+				continue;
+			}
+		}
+
+		literal += c;
+		++i;
+	}
+
+	flushLiteral();
+}
@@ -0,0 +1,76 @@
+/*
+	Copyright 2006-2024 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef FORMULATEMPLATE_H
+#define FORMULATEMPLATE_H
+
+#include <QSet>
+#include <QString>
+#include <QVector>
+
+class DiagramContext;
+
+/**
+	@brief The FormulaTemplate class
+	A formula (text with variables) split once into literal
+	and variable segments, which is then evaluated in one pass
+	against a DiagramContext.
+	Compiled formulas are cached by formula string, use FormulaTemplate::compile
+	to get them.
+
+	The result is the same as replacing each variable one after the other
+	in the formula, as long as a value doesn't bring a new variable
+	in the text. When the result still contains the start of a variable,
+	the caller must fall back to the sequential replacement.
+*/
+class FormulaTemplate
+{
+	public:
+		enum Syntax {
+			Braced,       ///variables in form %{var}
+			BracedAndBare ///variables in form %{var} or %var
+		};
+
+		FormulaTemplate() {}
+
+		static FormulaTemplate compile(const QString &formula,
+					       Syntax syntax = Braced);
+
+		QString evaluate(const DiagramContext &context) const;
+		QString evaluate(const DiagramContext &context,
+				 const QSet<QString> &keys) const;
+
+	private:
+		struct Segment
+		{
+			enum Kind {
+				Literal,
+				Variable,     ///%{text}
+				BareVariable  ///%text, text is the longest run of key characters
+			};
+
+			Kind m_kind = Literal;
+			QString m_text;
+		};
+
+		FormulaTemplate(const QString &formula, Syntax syntax);
+
+		QVector<Segment> m_segments;
+		int m_literal_size = 0;
+};
+
+#endif // FORMULATEMPLATE_H
@@ -0,0 +1,334 @@
+/*
+	Copyright 2006-2024 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef POTENTIALPARTITION_H
+#define POTENTIALPARTITION_H
+
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QVector>
+
+#include <utility>
+
+/**
+	@brief The PotentialPartition class
+	Terminals grouped in disjoint sets (union-find) of the same potential.
+	Two terminals are in the same set when they are linked by a conductor
+	or when relatedPotentialTerminal(terminal, all_diagram) return one
+	of them for the other.
+
+	T is the terminal type, it must have a method conductors()
+	which return the conductors linked to the terminal.
+	C is the conductor type, it must have the members terminal1 and terminal2.
+	relatedPotentialTerminal(const T *, bool) is found by argument
+	dependent lookup.
+
+	Adding a terminal or a conductor is merged into the sets.
+	A union-find can't split a set : when a terminal, a conductor or
+	a relation is removed, only the sets of the given terminals are split
+	in single terminals and walked again, the other sets are kept.
+*/
+template <typename T, typename C>
+class PotentialPartition
+{
+	public:
+		PotentialPartition(bool all_diagram) :
+			m_all_diagram(all_diagram)
+		{}
+
+		/**
+			@brief clear
+			Remove every terminal
+		*/
+		void clear()
+		{
+			m_nodes.clear();
+			m_parents.clear();
+			m_free_nodes.clear();
+			m_terminals.clear();
+			m_conductors.clear();
+		}
+
+		/**
+			@brief contains
+			@param terminal
+			@return true if terminal is in this partition
+		*/
+		bool contains(T *terminal) const {
+			return m_nodes.contains(terminal);
+		}
+
+		/**
+			@brief addTerminals
+			Add terminals to this partition and merge their sets
+			with the sets of the terminals already added
+			which are at the same potential.
+			@param terminals
+		*/
+		void addTerminals(const QList<T *> &terminals)
+		{
+			for (T *terminal : terminals) {
+				node(terminal);
+			}
+			for (T *terminal : terminals) {
+				walk(terminal, nullptr);
+			}
+		}
+
+		/**
+			@brief addConductor
+			Merge the sets of the two terminals of conductor
+			and add conductor to the merged set.
+			@param conductor
+			@return false if a terminal of conductor isn't in this partition,
+			nothing is done.
+		*/
+		bool addConductor(C *conductor)
+		{
+			if (!contains(conductor->terminal1)
+				|| !contains(conductor->terminal2)) {
+				return false;
+			}
+
+			unite(conductor->terminal1, conductor->terminal2);
+			m_conductors[find(conductor->terminal1)].insert(conductor);
+			return true;
+		}
+
+		/**
+			@brief removeConductor
+			Split the set of conductor, the conductor must be
+			already removed from the conductors() of its terminals
+			or it is ignored by the new sets.
+			@param conductor
+		*/
+		void removeConductor(C *conductor)
+		{
+			const int root = find(conductor->terminal1);
+			if (root == -1 || !m_conductors.value(root).contains(conductor)) {
+				return;
+			}
+			split({conductor->terminal1, conductor->terminal2},
+			      QSet<T *>(),
+			      conductor);
+		}
+
+		/**
+			@brief removeTerminals
+			Remove terminals from this partition and split their sets.
+			@param terminals
+		*/
+		void removeTerminals(const QList<T *> &terminals)
+		{
+			QSet<T *> removed;
+			for (T *terminal : terminals) {
+				removed.insert(terminal);
+			}
+			split(terminals, removed, nullptr);
+		}
+
+		/**
+			@brief relationsChanged
+			Split the sets of terminals, call it when the terminals
+			related to one of terminals changed.
+			@param terminals
+		*/
+		void relationsChanged(const QList<T *> &terminals) {
+			split(terminals, QSet<T *>(), nullptr);
+		}
+
+		/**
+			@brief find
+			@param terminal
+			@return the root node of the set of terminal
+			or -1 if terminal isn't in this partition
+		*/
+		int find(T *terminal)
+		{
+			const int node = m_nodes.value(terminal, -1);
+			return node == -1 ? -1 : root(node);
+		}
+
+		/**
+			@brief conductors
+			@param conductor
+			@return the conductors of the sets of the two terminals
+			of conductor, without conductor.
+		*/
+		QSet<C *> conductors(const C *conductor)
+		{
+			const int root_1 = find(conductor->terminal1);
+			const int root_2 = find(conductor->terminal2);
+
+			QSet<C *> conductors = m_conductors.value(root_1);
+			if (root_2 != root_1) {
+				conductors.unite(m_conductors.value(root_2));
+			}
+			conductors.remove(const_cast<C *>(conductor));
+			return conductors;
+		}
+
+	private:
+		/**
+			@brief node
+			@param terminal
+			@return the node of terminal, create it if needed
+		*/
+		int node(T *terminal)
+		{
+			auto it = m_nodes.constFind(terminal);
+			if (it != m_nodes.constEnd()) {
+				return it.value();
+			}
+
+			int node;
+			if (m_free_nodes.isEmpty())
+			{
+				node = m_parents.size();
+				m_parents.append(node);
+			}
+			else
+			{
+				node = m_free_nodes.takeLast();
+				m_parents[node] = node;
+			}
+			m_nodes.insert(terminal, node);
+			m_terminals[node] = {terminal};
+			return node;
+		}
+
+		/**
+			@brief root
+			@param node
+			@return the root of node, the path is halved on the way.
+		*/
+		int root(int node)
+		{
+			while (m_parents.at(node) != node)
+			{
+				m_parents[node] = m_parents.at(m_parents.at(node));
+				node = m_parents.at(node);
+			}
+			return node;
+		}
+
+		/**
+			@brief unite
+			Merge the sets of t1 and t2.
+			The smallest set is moved to the largest one.
+			@param t1
+			@param t2
+		*/
+		void unite(T *t1, T *t2)
+		{
+			int root_1 = root(node(t1));
+			int root_2 = root(node(t2));
+			if (root_1 == root_2) {
+				return;
+			}
+
+			if (m_terminals.value(root_1).size() < m_terminals.value(root_2).size()) {
+				std::swap(root_1, root_2);
+			}
+
+			m_parents[root_2] = root_1;
+			const QVector<T *> moved_terminals = m_terminals.take(root_2);
+			m_terminals[root_1] += moved_terminals;
+			const QSet<C *> moved = m_conductors.take(root_2);
+			if (!moved.isEmpty()) {
+				m_conductors[root_1].unite(moved);
+			}
+		}
+
+		/**
+			@brief walk
+			Merge the set of terminal with the sets of its related
+			terminals and of its conductors.
+			@param terminal
+			@param ignored : a conductor to not add
+		*/
+		void walk(T *terminal, const C *ignored)
+		{
+			for (T *related : relatedPotentialTerminal(terminal, m_all_diagram)) {
+				if (contains(related)) {
+					unite(terminal, related);
+				}
+			}
+			for (C *conductor : terminal->conductors()) {
+				if (conductor != ignored) {
+					addConductor(conductor);
+				}
+			}
+		}
+
+		/**
+			@brief split
+			Split the sets of terminals in single terminals,
+			remove the terminals of removed, then walk again
+			the other terminals of these sets.
+			@param terminals
+			@param removed : the terminals to remove
+			@param ignored : a conductor to not add
+		*/
+		void split(const QList<T *> &terminals,
+			   const QSet<T *> &removed,
+			   const C *ignored)
+		{
+			QVector<T *> members;
+			for (T *terminal : terminals)
+			{
+				const int root = find(terminal);
+				if (root == -1) {
+					continue;
+				}
+				members += m_terminals.take(root);
+				m_conductors.remove(root);
+			}
+
+				//Every node of the sets is reset, no other node lead to them
+			QVector<T *> kept;
+			for (T *member : qAsConst(members))
+			{
+				const int node = m_nodes.value(member);
+				m_parents[node] = node;
+				if (removed.contains(member))
+				{
+					m_nodes.remove(member);
+					m_free_nodes.append(node);
+				}
+				else
+				{
+					m_terminals[node] = {member};
+					kept.append(member);
+				}
+			}
+
+			for (T *member : qAsConst(kept)) {
+				walk(member, ignored);
+			}
+		}
+
+		bool m_all_diagram;
+		QHash<T *, int> m_nodes;
+		QVector<int> m_parents;
+		QVector<int> m_free_nodes;
+		QHash<int, QVector<T *>> m_terminals; ///< The terminals of each set, by root node
+		QHash<int, QSet<C *>> m_conductors;   ///< The conductors of each set, by root node
+};
+
+#endif // POTENTIALPARTITION_H
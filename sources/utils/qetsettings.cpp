@@ -20,6 +20,33 @@
 #include <QSettings>
 #include <QVariant>
 
+namespace
+{
+		///The diagram editor values read at each paint of a folio,
+		///kept in memory instead of reading QSettings each time.
+	struct DiagramEditorSettings
+	{
+		bool loaded = false;
+		int x_grid = 10;
+		int y_grid = 10;
+		bool zoom_out_beyond_of_folio = false;
+	};
+
+	DiagramEditorSettings &diagramEditorSettings()
+	{
+		static DiagramEditorSettings des;
+		if (!des.loaded)
+		{
+			QSettings settings;
+			des.x_grid = qMax(1, settings.value(QStringLiteral("diagrameditor/Xgrid"), 10).toInt());
+			des.y_grid = qMax(1, settings.value(QStringLiteral("diagrameditor/Ygrid"), 10).toInt());
+			des.zoom_out_beyond_of_folio = settings.value(QStringLiteral("diagrameditor/zoom-out-beyond-of-folio"), false).toBool();
+			des.loaded = true;
+		}
+		return des;
+	}
+}
+
 namespace QetSettings
 {
 #if QT_VERSION >= QT_VERSION_CHECK(5, 14, 0)
@@ -107,4 +134,67 @@ namespace QetSettings
 		}
 	}
 #endif
+
+	/**
+	* @brief gridXStep
+	* @return the horizontal step of the grid of the folios,
+	* stored with key : diagrameditor/Xgrid.
+	* The value is read once and kept in memory,
+	* use setGridStep to change it.
+	*/
+	int gridXStep() {
+		return diagramEditorSettings().x_grid;
+	}
+
+	/**
+	* @brief gridYStep
+	* @return the vertical step of the grid of the folios,
+	* stored with key : diagrameditor/Ygrid.
+	* @sa gridXStep
+	*/
+	int gridYStep() {
+		return diagramEditorSettings().y_grid;
+	}
+
+	/**
+	* @brief setGridStep
+	* Write the steps of the grid of the folios in
+	* QElectroTech settings and in the values kept in memory.
+	* @param x_step
+	* @param y_step
+	*/
+	void setGridStep(int x_step, int y_step)
+	{
+		auto &des = diagramEditorSettings();
+		des.x_grid = qMax(1, x_step);
+		des.y_grid = qMax(1, y_step);
+
+		QSettings settings;
+		settings.setValue("diagrameditor/Xgrid", x_step);
+		settings.setValue("diagrameditor/Ygrid", y_step);
+	}
+
+	/**
+	* @brief zoomOutBeyondOfFolio
+	* @return true if the user can zoom out beyond the folio,
+	* stored with key : diagrameditor/zoom-out-beyond-of-folio.
+	* The value is read once and kept in memory,
+	* use setZoomOutBeyondOfFolio to change it.
+	*/
+	bool zoomOutBeyondOfFolio() {
+		return diagramEditorSettings().zoom_out_beyond_of_folio;
+	}
+
+	/**
+	* @brief setZoomOutBeyondOfFolio
+	* Write the zoom out beyond of folio value in
+	* QElectroTech settings and in the value kept in memory.
+	* @param zoom_out
+	*/
+	void setZoomOutBeyondOfFolio(bool zoom_out)
+	{
+		diagramEditorSettings().zoom_out_beyond_of_folio = zoom_out;
+		QSettings settings;
+		settings.setValue("diagrameditor/zoom-out-beyond-of-folio", zoom_out);
+	}
 }
@@ -34,6 +34,12 @@ namespace QetSettings
 	Qt::HighDpiScaleFactorRoundingPolicy hdpiScaleFactorRoundingPolicy(
 			Qt::HighDpiScaleFactorRoundingPolicy default_policy = Qt::HighDpiScaleFactorRoundingPolicy::PassThrough);
 #endif
+
+	int gridXStep();
+	int gridYStep();
+	void setGridStep(int x_step, int y_step);
+	bool zoomOutBeyondOfFolio();
+	void setZoomOutBeyondOfFolio(bool zoom_out);
 }
 
 #endif // QETSETTINGS_H
@@ -0,0 +1,46 @@
+/*
+	Copyright 2006-2024 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "searchindex.h"
+
+/**
+	@brief searchTokens
+	Split text in the tokens used by SearchIndex :
+	the case folded runs of letters and numbers of text.
+	@param text
+	@return the tokens of text, in the order of text
+*/
+QStringList searchTokens(const QString &text)
+{
+	QStringList tokens;
+	QString token;
+	for (const QChar c : text)
+	{
+		if (c.isLetterOrNumber()) {
+			token += c.toCaseFolded();
+		}
+		else if (!token.isEmpty())
+		{
+			tokens.append(token);
+			token.clear();
+		}
+	}
+	if (!token.isEmpty()) {
+		tokens.append(token);
+	}
+	return tokens;
+}
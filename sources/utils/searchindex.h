@@ -0,0 +1,220 @@
+/*
+	Copyright 2006-2024 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#ifndef SEARCHINDEX_H
+#define SEARCHINDEX_H
+
+#include <QHash>
+#include <QMap>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+QStringList searchTokens(const QString &text);
+
+/**
+	@brief The SearchIndex class
+	An in memory inverted index of the searchable texts of items :
+	each text is split in case folded tokens (runs of letters and numbers),
+	the index keep for each token the items which use it.
+
+	candidates() return the items which can contain a searched text
+	without reading their texts : every token of the searched text must be
+	found in a token of the item. The result can contain items which don't
+	match exactly (case, separators), the caller must check the candidates
+	like it would check every item without the index.
+
+	The vocabulary of the index (the distinct tokens) is much smaller
+	than the number of texts, only the vocabulary is scanned at each query.
+	The tokens found for a query are kept until the index change,
+	when the next query start with a previous one (the user type
+	the next letter), only the tokens found for the previous one are scanned.
+*/
+template <typename T>
+class SearchIndex
+{
+	public:
+		/**
+			@brief insert
+			Index item with texts, replace the previous texts of item.
+			@param item
+			@param texts
+		*/
+		void insert(T item, const QStringList &texts)
+		{
+			remove(item);
+
+			QSet<QString> tokens;
+			for (const QString &text : texts) {
+				for (const QString &token : searchTokens(text)) {
+					tokens.insert(token);
+				}
+			}
+
+			for (const QString &token : qAsConst(tokens)) {
+				m_items_of_token[token].insert(item);
+			}
+			m_tokens_of_item.insert(item, tokens);
+			m_found_tokens.clear();
+		}
+
+		/**
+			@brief remove
+			Remove item from the index
+			@param item
+		*/
+		void remove(T item)
+		{
+			auto it = m_tokens_of_item.find(item);
+			if (it == m_tokens_of_item.end()) {
+				return;
+			}
+
+			for (const QString &token : qAsConst(it.value()))
+			{
+				auto token_it = m_items_of_token.find(token);
+				if (token_it == m_items_of_token.end()) {
+					continue;
+				}
+				token_it.value().remove(item);
+				if (token_it.value().isEmpty()) {
+					m_items_of_token.erase(token_it);
+				}
+			}
+			m_tokens_of_item.erase(it);
+			m_found_tokens.clear();
+		}
+
+		void clear()
+		{
+			m_tokens_of_item.clear();
+			m_items_of_token.clear();
+			m_found_tokens.clear();
+		}
+
+		bool contains(T item) const {
+			return m_tokens_of_item.contains(item);
+		}
+
+		int count() const {
+			return m_tokens_of_item.count();
+		}
+
+		/**
+			@brief candidates
+			@param text
+			@return the items which can contain text, if text doesn't have
+			any token, all the indexed items are returned.
+		*/
+		QSet<T> candidates(const QString &text) const
+		{
+			const QStringList query = searchTokens(text);
+			if (query.isEmpty())
+			{
+				QSet<T> items;
+				for (auto it = m_tokens_of_item.constBegin() ;
+				     it != m_tokens_of_item.constEnd() ; ++it) {
+					items.insert(it.key());
+				}
+				return items;
+			}
+
+			QSet<T> result;
+			bool first = true;
+			for (const QString &query_token : query)
+			{
+				QSet<T> items;
+				for (const QString &token : tokensContaining(query_token)) {
+					items.unite(m_items_of_token.value(token));
+				}
+
+				if (first) {
+					result = items;
+					first = false;
+				} else {
+					result.intersect(items);
+				}
+
+				if (result.isEmpty()) {
+					break;
+				}
+			}
+			return result;
+		}
+
+	private:
+		/**
+			@brief tokensContaining
+			@param query_token
+			@return the tokens of the vocabulary which contain query_token
+		*/
+		QStringList tokensContaining(const QString &query_token) const
+		{
+			auto found = m_found_tokens.constFind(query_token);
+			if (found != m_found_tokens.constEnd()) {
+				return found.value();
+			}
+
+				//The longest previous query contained in query_token,
+				//its tokens are the only ones which can contain query_token.
+			const QStringList *scanned = nullptr;
+			int scanned_length = 0;
+			for (auto it = m_found_tokens.constBegin() ;
+			     it != m_found_tokens.constEnd() ; ++it)
+			{
+				if (it.key().size() > scanned_length
+						&& query_token.contains(it.key()))
+				{
+					scanned = &it.value();
+					scanned_length = it.key().size();
+				}
+			}
+
+			QStringList tokens;
+			if (scanned)
+			{
+				for (const QString &token : *scanned) {
+					if (token.contains(query_token)) {
+						tokens.append(token);
+					}
+				}
+			}
+			else
+			{
+				for (auto it = m_items_of_token.constBegin() ;
+				     it != m_items_of_token.constEnd() ; ++it) {
+					if (it.key().contains(query_token)) {
+						tokens.append(it.key());
+					}
+				}
+			}
+
+			if (m_found_tokens.size() >= max_found_tokens) {
+				m_found_tokens.clear();
+			}
+			m_found_tokens.insert(query_token, tokens);
+			return tokens;
+		}
+
+		static const int max_found_tokens = 64;
+
+		QHash<T, QSet<QString>> m_tokens_of_item;
+		QMap<QString, QSet<T>> m_items_of_token;
+		mutable QHash<QString, QStringList> m_found_tokens;
+};
+
+#endif // SEARCHINDEX_H
@@ -0,0 +1,133 @@
+#include "../../../sources/diagramcontext.h"
+#include "../../../sources/utils/formulatemplate.h"
+
+#include <catch2/catch.hpp>
+
+namespace {
+	/**
+		Replace the variables one after the other,
+		like AssignVariables::replaceVariableSequentially
+	*/
+	QString bracedSequentially(const QString &formula,
+				   const DiagramContext &context,
+				   const QStringList &keys)
+	{
+		QString str = formula;
+		for (const QString &key : keys) {
+			str.replace("%{" + key + "}", context.value(key).toString());
+		}
+		return str;
+	}
+
+	/**
+		Replace the variables one after the other,
+		like TitleBlockTemplate::interpreteVariablesSequentially
+	*/
+	QString bracedAndBareSequentially(const QString &formula,
+					  const DiagramContext &context)
+	{
+		QString str = formula;
+		for (const QString &key : context.keys(DiagramContext::DecreasingLength)) {
+			str.replace("%{" + key + "}", context[key].toString());
+			str.replace("%" + key, context[key].toString());
+		}
+		return str;
+	}
+
+	DiagramContext testContext()
+	{
+		DiagramContext context;
+		context.addValue("label", "KM1");
+		context.addValue("plant", "P01");
+		context.addValue("folio", "3");
+		context.addValue("folio-total", "12");
+		context.addValue("folio-id", "F3");
+		context.addValue("f", "x");
+		context.addValue("empty", "");
+		return context;
+	}
+
+	const QStringList test_formulas {
+		"",
+		"no variable",
+		"%{label}",
+		"%{label}%{label}-%{label}",
+		"=%{plant}+%{label}",
+		"%{missing}",
+		"%{label}%{missing}%{plant}",
+		"%{label",
+		"%{}",
+		"%{LABEL}",
+		"100%",
+		"%%{label}%",
+		"%folio/%folio-total",
+		"%folio-id %folio-ids %folioid",
+		"%f%folio%{f}%{folio}",
+		"%{folio-total}%folio-total%folio",
+		"%empty%{empty}|",
+		"%unknown %{unknown}"
+	};
+}
+
+TEST_CASE("FormulaTemplate braced variables")
+{
+	const DiagramContext context = testContext();
+	const QStringList keys {"label", "plant", "missing", "f", "empty"};
+	const QSet<QString> keys_set(keys.begin(), keys.end());
+
+	for (const QString &formula : test_formulas)
+	{
+		INFO(formula.toStdString());
+		CHECK(FormulaTemplate::compile(formula).evaluate(context, keys_set)
+		      == bracedSequentially(formula, context, keys));
+	}
+}
+
+TEST_CASE("FormulaTemplate braced and bare variables")
+{
+	const DiagramContext context = testContext();
+
+	for (const QString &formula : test_formulas)
+	{
+		INFO(formula.toStdString());
+		CHECK(FormulaTemplate::compile(formula, FormulaTemplate::BracedAndBare)
+		      .evaluate(context)
+		      == bracedAndBareSequentially(formula, context));
+	}
+}
+
+TEST_CASE("FormulaTemplate cache")
+{
+	const DiagramContext context = testContext();
+	const QString formula("%{label}-%folio");
+
+		//Same formula, other syntax : not the same compiled template
+	CHECK(FormulaTemplate::compile(formula).evaluate(context)
+	      == QString("KM1-%folio"));
+	CHECK(FormulaTemplate::compile(formula, FormulaTemplate::BracedAndBare)
+	      .evaluate(context)
+	      == QString("KM1-3"));
+}
+
+TEST_CASE("FormulaTemplate benchmark", "[.][benchmark]")
+{
+	const DiagramContext context = testContext();
+	const QStringList keys {"label", "plant", "missing", "f", "empty"};
+	const QSet<QString> keys_set(keys.begin(), keys.end());
+	const QString formula("=%{plant}+%{label} %{missing} -%{label}");
+	const QString title_formula("Folio %folio/%folio-total (%{folio-id})");
+
+	BENCHMARK("braced, sequential replace") {
+		return bracedSequentially(formula, context, keys);
+	};
+	BENCHMARK("braced, compiled template") {
+		return FormulaTemplate::compile(formula).evaluate(context, keys_set);
+	};
+	BENCHMARK("braced and bare, sequential replace") {
+		return bracedAndBareSequentially(title_formula, context);
+	};
+	BENCHMARK("braced and bare, compiled template") {
+		return FormulaTemplate::compile(title_formula, FormulaTemplate::BracedAndBare)
+				.evaluate(context);
+	};
+}
@@ -0,0 +1,340 @@
+/*
+	Copyright 2006-2024 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "../../../sources/utils/potentialpartition.h"
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+	struct TestConductor;
+	struct TestElement;
+
+	struct TestTerminal
+	{
+		TestElement *element = nullptr;
+		QList<TestConductor *> m_conductors;
+		QList<TestConductor *> conductors() const {return m_conductors;}
+	};
+
+	struct TestConductor
+	{
+		TestTerminal *terminal1 = nullptr;
+		TestTerminal *terminal2 = nullptr;
+		bool alive = true;
+	};
+
+	struct TestElement
+	{
+		enum Kind {Simple, Terminale, Report};
+		Kind kind = Simple;
+		QList<TestTerminal *> terminals;
+		TestElement *linked = nullptr;
+		bool alive = true;
+	};
+
+	/**
+		Same rules as relatedPotentialTerminal of terminal.cpp
+	*/
+	QList<TestTerminal *> relatedPotentialTerminal(const TestTerminal *terminal,
+						       bool all_diagram)
+	{
+		if (all_diagram && terminal->element->kind == TestElement::Report)
+		{
+			if (terminal->element->linked) {
+				return terminal->element->linked->terminals;
+			}
+		}
+		else if (terminal->element->kind == TestElement::Terminale)
+		{
+			QList<TestTerminal *> terminals = terminal->element->terminals;
+			terminals.removeAll(const_cast<TestTerminal *>(terminal));
+			return terminals;
+		}
+		return QList<TestTerminal *>();
+	}
+
+	/**
+		Walk through the terminals linked to conductor,
+		like PotentialIndex::search
+	*/
+	QSet<TestConductor *> searchConductors(const TestConductor *conductor,
+					       bool all_diagram)
+	{
+		QSet<TestConductor *> conductors;
+		QSet<TestTerminal *> visited;
+		QVector<TestTerminal *> to_visit{conductor->terminal1, conductor->terminal2};
+
+		while (!to_visit.isEmpty())
+		{
+			TestTerminal *terminal = to_visit.takeLast();
+			if (visited.contains(terminal)) {
+				continue;
+			}
+			visited.insert(terminal);
+
+			for (TestTerminal *t : relatedPotentialTerminal(terminal, all_diagram)) {
+				to_visit.append(t);
+			}
+			for (TestConductor *c : terminal->conductors())
+			{
+				conductors.insert(c);
+				to_visit << c->terminal1 << c->terminal2;
+			}
+		}
+
+		conductors.remove(const_cast<TestConductor *>(conductor));
+		return conductors;
+	}
+
+	/**
+		Random folios of elements, conductors and linked reports,
+		changed like the diagrams of a project.
+	*/
+	class TestProject
+	{
+		public:
+			TestProject(unsigned int seed) :
+				m_random(seed),
+				m_project_partition(true),
+				m_diagram_partition(false)
+			{
+				for (int i = 0 ; i < 40 ; ++i) {
+					addElement();
+				}
+				for (int i = 0 ; i < 60 ; ++i) {
+					addConductor();
+				}
+				for (int i = 0 ; i < 6 ; ++i) {
+					linkReports();
+				}
+			}
+
+			void addElement()
+			{
+				auto element = std::make_unique<TestElement>();
+				element->kind = TestElement::Kind(randomInt(3));
+				const int count = element->kind == TestElement::Report ? 1
+											: 1 + randomInt(3);
+				for (int i = 0 ; i < count ; ++i)
+				{
+					auto terminal = std::make_unique<TestTerminal>();
+					terminal->element = element.get();
+					element->terminals << terminal.get();
+					m_terminals.push_back(std::move(terminal));
+				}
+				m_project_partition.addTerminals(element->terminals);
+				m_diagram_partition.addTerminals(element->terminals);
+				m_elements.push_back(std::move(element));
+			}
+
+			void addConductor()
+			{
+				TestTerminal *t1 = randomTerminal();
+				TestTerminal *t2 = randomTerminal();
+				if (!t1 || !t2 || t1 == t2) {
+					return;
+				}
+
+				auto conductor = std::make_unique<TestConductor>();
+				conductor->terminal1 = t1;
+				conductor->terminal2 = t2;
+				t1->m_conductors << conductor.get();
+				t2->m_conductors << conductor.get();
+				m_project_partition.addConductor(conductor.get());
+				m_diagram_partition.addConductor(conductor.get());
+				m_conductors.push_back(std::move(conductor));
+			}
+
+				///Like Terminal::removeConductor called by the two terminals
+			void removeConductor(TestConductor *conductor)
+			{
+				conductor->alive = false;
+				for (TestTerminal *terminal : {conductor->terminal1, conductor->terminal2})
+				{
+					terminal->m_conductors.removeAll(conductor);
+					m_project_partition.removeConductor(conductor);
+					m_diagram_partition.removeConductor(conductor);
+				}
+			}
+
+			void removeRandomConductor()
+			{
+				if (TestConductor *conductor = randomConductor()) {
+					removeConductor(conductor);
+				}
+			}
+
+				///Like Diagram::removeItem, the conductors are removed after
+			void removeRandomElement()
+			{
+				TestElement *element = randomElement();
+				if (!element) {
+					return;
+				}
+
+				unlinkReport(element);
+				element->alive = false;
+				m_project_partition.removeTerminals(element->terminals);
+				m_diagram_partition.removeTerminals(element->terminals);
+				for (TestTerminal *terminal : qAsConst(element->terminals)) {
+					for (TestConductor *conductor : terminal->conductors()) {
+						removeConductor(conductor);
+					}
+				}
+			}
+
+				///Like ReportElement::linkToElement
+			void linkReports()
+			{
+				TestElement *report_1 = randomElement(TestElement::Report);
+				TestElement *report_2 = randomElement(TestElement::Report);
+				if (!report_1 || !report_2 || report_1 == report_2) {
+					return;
+				}
+
+				unlinkReport(report_1);
+				unlinkReport(report_2);
+				report_1->linked = report_2;
+				report_2->linked = report_1;
+				m_project_partition.relationsChanged(report_2->terminals);
+				m_project_partition.relationsChanged(report_1->terminals);
+			}
+
+				///Like ReportElement::unlinkAllElements
+			void unlinkReport(TestElement *report)
+			{
+				TestElement *linked = report->linked;
+				if (!linked) {
+					return;
+				}
+
+				report->linked = nullptr;
+				linked->linked = nullptr;
+				m_project_partition.relationsChanged(linked->terminals);
+				m_project_partition.relationsChanged(report->terminals);
+			}
+
+			void unlinkRandomReport()
+			{
+				if (TestElement *report = randomElement(TestElement::Report)) {
+					unlinkReport(report);
+				}
+			}
+
+			void change()
+			{
+				switch (randomInt(6))
+				{
+					case 0: addElement(); break;
+					case 1: removeRandomElement(); break;
+					case 2: removeRandomConductor(); break;
+					case 3: linkReports(); break;
+					case 4: unlinkRandomReport(); break;
+					default: addConductor(); break;
+				}
+			}
+
+				///Check every conductor, return the count of checked conductors
+			int check()
+			{
+				int checked = 0;
+				for (const auto &conductor : m_conductors)
+				{
+					if (!conductor->alive) {
+						continue;
+					}
+					++checked;
+					CHECK(m_project_partition.conductors(conductor.get())
+					      == searchConductors(conductor.get(), true));
+					CHECK(m_diagram_partition.conductors(conductor.get())
+					      == searchConductors(conductor.get(), false));
+				}
+				return checked;
+			}
+
+		private:
+			int randomInt(int max) {
+				return std::uniform_int_distribution<int>(0, max - 1)(m_random);
+			}
+
+			TestElement *randomElement(int kind = -1)
+			{
+				QVector<TestElement *> elements;
+				for (const auto &element : m_elements) {
+					if (element->alive && (kind == -1 || element->kind == kind)) {
+						elements << element.get();
+					}
+				}
+				return elements.isEmpty() ? nullptr
+							  : elements.at(randomInt(elements.size()));
+			}
+
+			TestTerminal *randomTerminal()
+			{
+				TestElement *element = randomElement();
+				return element ? element->terminals.at(randomInt(element->terminals.size()))
+					       : nullptr;
+			}
+
+			TestConductor *randomConductor()
+			{
+				QVector<TestConductor *> conductors;
+				for (const auto &conductor : m_conductors) {
+					if (conductor->alive) {
+						conductors << conductor.get();
+					}
+				}
+				return conductors.isEmpty() ? nullptr
+							    : conductors.at(randomInt(conductors.size()));
+			}
+
+			std::mt19937 m_random;
+			std::vector<std::unique_ptr<TestElement>> m_elements;
+			std::vector<std::unique_ptr<TestTerminal>> m_terminals;
+			std::vector<std::unique_ptr<TestConductor>> m_conductors;
+			PotentialPartition<TestTerminal, TestConductor> m_project_partition;
+			PotentialPartition<TestTerminal, TestConductor> m_diagram_partition;
+	};
+}
+
+TEST_CASE("PotentialPartition built element by element")
+{
+	for (unsigned int seed = 1 ; seed <= 20 ; ++seed)
+	{
+		INFO("seed " << seed);
+		TestProject project(seed);
+		CHECK(project.check() > 0);
+	}
+}
+
+TEST_CASE("PotentialPartition updated by the changes of the folios")
+{
+	for (unsigned int seed = 1 ; seed <= 20 ; ++seed)
+	{
+		TestProject project(seed);
+		for (int i = 0 ; i < 100 ; ++i)
+		{
+			INFO("seed " << seed << ", change " << i);
+			project.change();
+			project.check();
+		}
+	}
+}
@@ -0,0 +1,126 @@
+/*
+	Copyright 2006-2024 The QElectroTech Team
+	This file is part of QElectroTech.
+
+	QElectroTech is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 2 of the License, or
+	(at your option) any later version.
+
+	QElectroTech is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with QElectroTech.  If not, see <http://www.gnu.org/licenses/>.
+*/
+#include "../../../sources/utils/searchindex.h"
+
+#include <catch2/catch.hpp>
+
+namespace {
+	const QVector<QStringList> test_texts {
+		{"KM1", "Contacteur moteur pompe"},
+		{"KM12", "contacteur"},
+		{"-Q1", "Disjoncteur 10A"},
+		{"=P01+A1-X1", "Bornier"},
+		{"X1:3", ""},
+		{"Électrovanne", "Ventil_24V"},
+		{"ÉLECTROVANNE 2"},
+		{"F3", "fusible 2A gG"},
+		{"S1 / S2", "Bouton poussoir"},
+		{},
+		{"---"}
+	};
+
+	const QStringList test_queries {
+		"",
+		" ",
+		"-",
+		"k", "km", "km1", "km12", "km2",
+		"KM1", "Km1",
+		"conta", "CONTACTEUR moteur", "teur mot", "r m",
+		"q1", "-q1", "=p01+a1", "01+A", "+a1-x1",
+		"x1:", "X1:3", ":3",
+		"électro", "ÉLECTRO", "vanne 2", "ventil_", "_24",
+		"10a", "a gg", "2A g",
+		"s1 / s", "1 / S2", "/",
+		"absent", "km1 absent"
+	};
+
+	/**
+		The items matched without the index,
+		like SearchAndReplaceWidget did for each item
+	*/
+	QSet<int> containing(const QString &text)
+	{
+		QSet<int> items;
+		for (int i = 0 ; i < test_texts.size() ; ++i) {
+			for (const QString &item_text : test_texts.at(i)) {
+				if (item_text.contains(text, Qt::CaseInsensitive)) {
+					items.insert(i);
+				}
+			}
+		}
+		return items;
+	}
+
+	SearchIndex<int> testIndex()
+	{
+		SearchIndex<int> index;
+		for (int i = 0 ; i < test_texts.size() ; ++i) {
+			index.insert(i, test_texts.at(i));
+		}
+		return index;
+	}
+}
+
+TEST_CASE("SearchIndex candidates contain the matching items")
+{
+	const SearchIndex<int> index = testIndex();
+
+	for (const QString &query : test_queries)
+	{
+		INFO(query.toStdString());
+		const QSet<int> candidates = index.candidates(query);
+		for (int item : containing(query)) {
+			CHECK(candidates.contains(item));
+		}
+	}
+}
+
+TEST_CASE("SearchIndex candidates while the query is typed")
+{
+	const SearchIndex<int> index = testIndex();
+
+		//Each typed text starts with the previous one,
+		//the tokens found for the previous one are reused
+	for (const QString &query : test_queries)
+	{
+		for (int length = 1 ; length <= query.size() ; ++length)
+		{
+			const QString typed = query.left(length);
+			INFO(typed.toStdString());
+			const QSet<int> candidates = index.candidates(typed);
+			for (int item : containing(typed)) {
+				CHECK(candidates.contains(item));
+			}
+		}
+	}
+}
+
+TEST_CASE("SearchIndex candidates after a change of the index")
+{
+	SearchIndex<int> index = testIndex();
+	CHECK(index.candidates("km1").contains(0));
+
+	index.insert(0, {"KA5"});
+	CHECK_FALSE(index.candidates("km1").contains(0));
+	CHECK(index.candidates("ka").contains(0));
+
+	index.remove(1);
+	CHECK_FALSE(index.candidates("km").contains(1));
+	CHECK_FALSE(index.contains(1));
+	CHECK(index.count() == test_texts.size() - 1);
+}